@@ -0,0 +1,747 @@
+#include "api_functions.h"
+#include "geometric_functions.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+/**
+ * geo_bench - throughput of the API functions.
+ *
+ * Usage: geo_bench [--quick] [--threads <max>] [--csv <file>] [--json <file>]
+ *
+ * Prints a table of ns/op and ops/s; --csv / --json also write the same rows to a file.
+ * Every case runs on fixed input arrays (no heap, like the library itself), with inputs drawn
+ * either in random order or along a spatially coherent path. Build in Release for real numbers.
+ */
+
+// --- Bench Framework ---
+typedef std::chrono::steady_clock Clock;
+
+struct SBenchRow {
+    char group[24];
+    char function[32];
+    char variant[24];
+    uint32_t vertices;
+    double nsPerOp;
+    double opsPerSec;
+};
+
+const uint32_t MAX_ROWS = 512;
+SBenchRow g_rows[MAX_ROWS];
+uint32_t g_rowCount = 0;
+
+double g_minSeconds = 0.25;
+volatile uint64_t g_sink = 0; // keeps results alive so calls are not optimized away
+
+// Runs body (which performs opsPerRun operations) until g_minSeconds have passed.
+template <typename TBody>
+double MeasureNsPerOp(uint32_t opsPerRun, TBody body) {
+    body(); // warm-up
+
+    uint64_t runs = 0;
+    double elapsed = 0.0;
+    const Clock::time_point start = Clock::now();
+    do {
+        body();
+        runs++;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < g_minSeconds);
+
+    return elapsed * 1e9 / ((double)runs * opsPerRun);
+}
+
+template <typename TBody>
+void Bench(const char* group, const char* function, const char* variant, uint32_t vertices, uint32_t opsPerRun, TBody body) {
+    const double nsPerOp = MeasureNsPerOp(opsPerRun, body);
+    if (g_rowCount < MAX_ROWS) {
+        SBenchRow& row = g_rows[g_rowCount++];
+        std::snprintf(row.group, sizeof(row.group), "%s", group);
+        std::snprintf(row.function, sizeof(row.function), "%s", function);
+        std::snprintf(row.variant, sizeof(row.variant), "%s", variant);
+        row.vertices = vertices;
+        row.nsPerOp = nsPerOp;
+        row.opsPerSec = 1e9 / nsPerOp;
+    }
+    std::printf("%-10s %-26s %-18s %8u %14.1f %16.0f\n", group, function, variant, vertices, nsPerOp, 1e9 / nsPerOp);
+    std::fflush(stdout);
+}
+
+// --- Inputs ---
+
+// Deterministic pseudo random generator (runs must be comparable)
+uint32_t g_randState = 12345u;
+double RandUnit() {
+    g_randState = g_randState * 1664525u + 1013904223u;
+    return (g_randState >> 8) / 16777216.0;
+}
+
+double RandRange(double lo, double hi) {
+    return lo + (hi - lo) * RandUnit();
+}
+
+const double PI_VALUE = 3.14159265358979323846;
+const uint32_t MAX_INPUTS = 1024;
+const uint16_t MAX_VERTICES = 65535;
+const uint16_t POLYGON_SIZES[] = { 3, 16, 256, 4096, 65535 };
+// Polygon vertices lie between these radii (m) around the origin
+const double POLY_INNER_RADIUS = 600.0;
+const double POLY_OUTER_RADIUS = 1000.0;
+
+SPointNE g_polygon[MAX_VERTICES];
+SPointNE g_points[MAX_INPUTS];
+float g_azimuths[MAX_INPUTS];
+SRayNE g_rays[MAX_INPUTS];
+SRayHit g_hits[MAX_INPUTS];
+uint8_t g_flags[MAX_INPUTS];
+SPointGeo g_geo[MAX_INPUTS];
+SPointNED g_ned[MAX_INPUTS];
+SPointECEF g_ecef[MAX_INPUTS];
+alignas(8) uint8_t g_prepared[1 << 26];
+
+// Jagged star with vertexCount vertices (a triangle for 3)
+void BuildPolygon(uint16_t vertexCount) {
+    for (uint32_t i = 0; i < vertexCount; ++i) {
+        const double angle = 2.0 * PI_VALUE * i / vertexCount;
+        const double radius = (vertexCount <= 4 || i % 2 == 0) ? POLY_OUTER_RADIUS : RandRange(POLY_INNER_RADIUS, POLY_OUTER_RADIUS);
+        g_polygon[i] = { (float)(radius * std::cos(angle)), (float)(radius * std::sin(angle)) };
+    }
+}
+
+// Points on a ring [rMin, rMax] around the origin, in random order or walking along the ring.
+// Each point gets the azimuth pointing at the origin (inward) or away from it.
+void BuildPoints(uint32_t count, double rMin, double rMax, bool coherent, bool inward) {
+    for (uint32_t i = 0; i < count; ++i) {
+        const double angle = coherent ? 2.0 * PI_VALUE * i / count : RandRange(0.0, 2.0 * PI_VALUE);
+        const double radius = coherent ? 0.5 * (rMin + rMax) : RandRange(rMin, rMax);
+        g_points[i] = { (float)(radius * std::cos(angle)), (float)(radius * std::sin(angle)) };
+        const double outward = angle * 180.0 / PI_VALUE;
+        g_azimuths[i] = (float)(inward ? outward + 180.0 : outward);
+    }
+}
+
+// Fewer inputs per run for big polygons, so a run stays short
+uint32_t InputsFor(uint16_t vertexCount) {
+    uint32_t count = (1u << 22) / vertexCount;
+    if (count > MAX_INPUTS) count = MAX_INPUTS;
+    if (count < 16) count = 16;
+    return count;
+}
+
+// --- Benchmarks ---
+
+void BenchPolygonQueries() {
+    // Triangle inner radius is half its circumradius
+    for (uint16_t vertexCount : POLYGON_SIZES) {
+        BuildPolygon(vertexCount);
+        const uint32_t count = InputsFor(vertexCount);
+        const double insideRadius = (vertexCount <= 4) ? 0.4 * POLY_OUTER_RADIUS : 0.9 * POLY_INNER_RADIUS;
+
+        uint32_t preparedSize = 0;
+        uint8_t state = EResultState::OK;
+        GetPreparedPolygonSize(g_polygon, vertexCount, &preparedSize, &state);
+        const bool hasPrepared = state == EResultState::OK && preparedSize <= sizeof(g_prepared);
+        if (hasPrepared) {
+            PreparePolygon(g_polygon, vertexCount, g_prepared, sizeof(g_prepared), &state);
+        }
+        SPolygonBounds bounds;
+        InitPolygonBounds(g_polygon, vertexCount, &bounds, &state);
+
+        for (int c = 0; c < 4; ++c) {
+            const bool hit = (c & 1) == 0;
+            const bool coherent = (c & 2) != 0;
+            char variant[24];
+            std::snprintf(variant, sizeof(variant), "%s/%s", hit ? "hit" : "miss", coherent ? "coherent" : "random");
+
+            // Containment: hit = inside the inner disk, miss = outside the outer radius
+            if (hit) BuildPoints(count, 0.0, insideRadius, coherent, true);
+            else BuildPoints(count, 1.2 * POLY_OUTER_RADIUS, 2.0 * POLY_OUTER_RADIUS, coherent, false);
+
+            Bench("polygon", "isInsidePolygon", variant, vertexCount, count, [&]() {
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint8_t res, st;
+                    isInsidePolygon(g_polygon, vertexCount, g_points[i], 1.0f, &res, &st);
+                    g_sink += res;
+                }
+            });
+            if (hasPrepared) {
+                Bench("polygon", "isInsidePolygonPrepared", variant, vertexCount, count, [&]() {
+                    for (uint32_t i = 0; i < count; ++i) {
+                        uint8_t res, st;
+                        isInsidePolygonPrepared(g_prepared, g_points[i], 1.0f, &res, &st);
+                        g_sink += res;
+                    }
+                });
+            }
+            Bench("polygon", "isInsidePolygonBounded", variant, vertexCount, count, [&]() {
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint8_t res, st;
+                    isInsidePolygonBounded(g_polygon, vertexCount, &bounds, g_points[i], 1.0f, &res, &st);
+                    g_sink += res;
+                }
+            });
+            if (coherent) {
+                SPolygonTracker tracker;
+                InitPolygonTracker(g_polygon, vertexCount, &tracker, &state);
+                Bench("polygon", "isInsidePolygonTracked", variant, vertexCount, count, [&]() {
+                    for (uint32_t i = 0; i < count; ++i) {
+                        uint8_t res, st;
+                        isInsidePolygonTracked(g_polygon, vertexCount, &tracker, g_points[i], 1.0f, &res, &st);
+                        g_sink += res;
+                    }
+                });
+            }
+            Bench("polygon", "getPolygonClearance", variant, vertexCount, count, [&]() {
+                for (uint32_t i = 0; i < count; ++i) {
+                    SPolygonClearance clearance;
+                    uint8_t st;
+                    getPolygonClearance(g_polygon, vertexCount, g_points[i], 1.0f, &clearance, &st);
+                    g_sink += clearance.isCollision;
+                }
+            });
+            Bench("polygon", "isInsidePolygonBatch", variant, vertexCount, count, [&]() {
+                uint8_t st;
+                isInsidePolygonBatch(g_polygon, vertexCount, g_points, count, nullptr, 1.0f, g_flags, &st);
+                g_sink += g_flags[0];
+            });
+
+            // Segments start outside; hit = aimed at the center, miss = aimed away
+            BuildPoints(count, 1.2 * POLY_OUTER_RADIUS, 2.0 * POLY_OUTER_RADIUS, coherent, hit);
+            for (uint32_t i = 0; i < count; ++i) {
+                g_rays[i] = { g_points[i], g_azimuths[i], (float)POLY_OUTER_RADIUS };
+            }
+
+            Bench("polygon", "doesLineIntersectPolygon", variant, vertexCount, count, [&]() {
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint8_t res, st;
+                    doesLineIntersectPolygon(g_polygon, vertexCount, g_points[i], g_azimuths[i], (float)POLY_OUTER_RADIUS, &res, &st);
+                    g_sink += res;
+                }
+            });
+            Bench("polygon", "doesLineIntersectPolygonBounded", variant, vertexCount, count, [&]() {
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint8_t res, st;
+                    doesLineIntersectPolygonBounded(g_polygon, vertexCount, &bounds, g_points[i], g_azimuths[i], (float)POLY_OUTER_RADIUS, &res, &st);
+                    g_sink += res;
+                }
+            });
+            Bench("polygon", "getFirstRayHit", variant, vertexCount, count, [&]() {
+                uint8_t st;
+                getFirstRayHitBatch(g_polygon, vertexCount, g_rays, count, g_hits, &st);
+                g_sink += g_hits[0].isHit;
+            });
+            if (hasPrepared) {
+                Bench("polygon", "getFirstRayHitPrepared", variant, vertexCount, count, [&]() {
+                    for (uint32_t i = 0; i < count; ++i) {
+                        uint8_t st;
+                        getFirstRayHitPrepared(g_prepared, g_rays[i], &g_hits[i], &st);
+                        g_sink += g_hits[i].isHit;
+                    }
+                });
+            }
+        }
+    }
+}
+
+// Regular polygons: the general scans vs the convex fast paths
+void BenchConvexQueries() {
+    for (uint16_t vertexCount : POLYGON_SIZES) {
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            const double angle = 2.0 * PI_VALUE * i / vertexCount;
+            g_polygon[i] = { (float)(POLY_OUTER_RADIUS * std::cos(angle)), (float)(POLY_OUTER_RADIUS * std::sin(angle)) };
+        }
+        const uint32_t count = InputsFor(vertexCount);
+
+        SPolygonConvexity convexity;
+        uint8_t state = EResultState::OK;
+        InitPolygonConvexity(g_polygon, vertexCount, &convexity, &state);
+        if (state != EResultState::OK || !convexity.isConvex) {
+            std::printf("convex: %u-gon is not convex after rounding to float, skipped\n", vertexCount);
+            continue;
+        }
+
+        for (int hit = 1; hit >= 0; --hit) {
+            const char* variant = hit ? "hit/random" : "miss/random";
+            if (hit) BuildPoints(count, 0.0, 0.9 * POLY_OUTER_RADIUS, false, true);
+            else BuildPoints(count, 1.2 * POLY_OUTER_RADIUS, 2.0 * POLY_OUTER_RADIUS, false, false);
+
+            Bench("convex", "isInsidePolygon", variant, vertexCount, count, [&]() {
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint8_t res, st;
+                    isInsidePolygon(g_polygon, vertexCount, g_points[i], 1.0f, &res, &st);
+                    g_sink += res;
+                }
+            });
+            Bench("convex", "isInsidePolygonConvex", variant, vertexCount, count, [&]() {
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint8_t res, st;
+                    isInsidePolygonConvex(g_polygon, vertexCount, &convexity, g_points[i], 1.0f, &res, &st);
+                    g_sink += res;
+                }
+            });
+
+            // Segments start outside; hit = aimed at the center, miss = aimed away
+            BuildPoints(count, 1.2 * POLY_OUTER_RADIUS, 2.0 * POLY_OUTER_RADIUS, false, hit);
+            Bench("convex", "doesLineIntersectPolygon", variant, vertexCount, count, [&]() {
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint8_t res, st;
+                    doesLineIntersectPolygon(g_polygon, vertexCount, g_points[i], g_azimuths[i], (float)POLY_OUTER_RADIUS, &res, &st);
+                    g_sink += res;
+                }
+            });
+            Bench("convex", "doesLineIntersectPolygonConvex", variant, vertexCount, count, [&]() {
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint8_t res, st;
+                    doesLineIntersectPolygonConvex(g_polygon, vertexCount, &convexity, g_points[i], g_azimuths[i], (float)POLY_OUTER_RADIUS, &res, &st);
+                    g_sink += res;
+                }
+            });
+        }
+    }
+}
+
+// Round zone with a round hole of half its radius, vertexCount vertices per ring packed in g_polygon:
+// one multi-ring call vs the two single-ring calls a caller would otherwise combine
+void BenchMultiRingQueries() {
+    const uint16_t sizes[] = { 16, 256, 4096 };
+    for (uint16_t vertexCount : sizes) {
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            const double angle = 2.0 * PI_VALUE * i / vertexCount;
+            g_polygon[i] = { (float)(POLY_OUTER_RADIUS * std::cos(angle)), (float)(POLY_OUTER_RADIUS * std::sin(angle)) };
+            g_polygon[vertexCount + i] = { (float)(0.5 * POLY_OUTER_RADIUS * std::cos(angle)), (float)(0.5 * POLY_OUTER_RADIUS * std::sin(angle)) };
+        }
+        const SPointNE* hole = g_polygon + vertexCount;
+        const uint32_t offsets[] = { 0, vertexCount, 2u * vertexCount };
+        const uint32_t count = InputsFor(vertexCount);
+        BuildPoints(count, 0.0, 1.5 * POLY_OUTER_RADIUS, false, true);
+
+        Bench("rings", "isInsidePolygon x2", "random", vertexCount, count, [&]() {
+            for (uint32_t i = 0; i < count; ++i) {
+                uint8_t inOuter, inHole, st;
+                isInsidePolygon(g_polygon, vertexCount, g_points[i], 1.0f, &inOuter, &st);
+                isInsidePolygon(hole, vertexCount, g_points[i], 1.0f, &inHole, &st);
+                g_sink += inOuter + inHole;
+            }
+        });
+        Bench("rings", "isInsideMultiPolygon", "random", vertexCount, count, [&]() {
+            for (uint32_t i = 0; i < count; ++i) {
+                uint8_t res, st;
+                isInsideMultiPolygon(g_polygon, offsets, 2, g_points[i], 1.0f, &res, &st);
+                g_sink += res;
+            }
+        });
+        Bench("rings", "doesLineIntersectPolygon x2", "random", vertexCount, count, [&]() {
+            for (uint32_t i = 0; i < count; ++i) {
+                uint8_t hitOuter, hitHole, st;
+                doesLineIntersectPolygon(g_polygon, vertexCount, g_points[i], g_azimuths[i], 100.0f, &hitOuter, &st);
+                doesLineIntersectPolygon(hole, vertexCount, g_points[i], g_azimuths[i], 100.0f, &hitHole, &st);
+                g_sink += hitOuter + hitHole;
+            }
+        });
+        Bench("rings", "doesLineIntersectMultiPolygon", "random", vertexCount, count, [&]() {
+            for (uint32_t i = 0; i < count; ++i) {
+                uint8_t res, st;
+                doesLineIntersectMultiPolygon(g_polygon, offsets, 2, g_points[i], g_azimuths[i], 100.0f, &res, &st);
+                g_sink += res;
+            }
+        });
+    }
+}
+
+// Route of 512 waypoints circling outside the polygon: one call vs one doesLineIntersectPolygon per leg
+void BenchRouteQueries() {
+    const uint32_t waypointCount = 512;
+    const uint16_t sizes[] = { 16, 256 };
+    for (uint16_t vertexCount : sizes) {
+        BuildPolygon(vertexCount);
+        BuildPoints(waypointCount, 1.5 * POLY_OUTER_RADIUS, 1.5 * POLY_OUTER_RADIUS, true, false);
+        for (uint32_t i = 0; i + 1 < waypointCount; ++i) {
+            const double dn = (double)g_points[i + 1].north - g_points[i].north;
+            const double de = (double)g_points[i + 1].east - g_points[i].east;
+            g_azimuths[i] = (float)(std::atan2(de, dn) * 180.0 / PI_VALUE);
+            g_rays[i] = { g_points[i], g_azimuths[i], (float)std::sqrt(dn * dn + de * de) };
+        }
+
+        Bench("route", "doesLineIntersectPolygon x legs", "miss", vertexCount, waypointCount - 1, [&]() {
+            for (uint32_t i = 0; i + 1 < waypointCount; ++i) {
+                uint8_t res, st;
+                doesLineIntersectPolygon(g_polygon, vertexCount, g_rays[i].startPoint, g_rays[i].azimuthDegrees, g_rays[i].maxLength, &res, &st);
+                g_sink += res;
+            }
+        });
+        Bench("route", "doesRouteIntersectPolygon", "miss", vertexCount, waypointCount - 1, [&]() {
+            SRouteViolation violation;
+            uint8_t st;
+            doesRouteIntersectPolygon(g_polygon, vertexCount, g_points, waypointCount, &violation, &st);
+            g_sink += violation.isViolation;
+        });
+    }
+}
+
+const uint32_t ZONE_COUNT = 5000;
+const uint16_t ZONE_POINTS = 8;
+SPointNE g_zonePoints[ZONE_COUNT * ZONE_POINTS];
+uint16_t g_zoneCounts[ZONE_COUNT];
+uint32_t g_zoneHits[ZONE_COUNT];
+SPointGeo g_zoneGeo[ZONE_COUNT * ZONE_POINTS];
+SPointNE g_zoneImported[ZONE_COUNT * ZONE_POINTS];
+SPolygonBounds g_zoneBounds[ZONE_COUNT];
+alignas(8) uint8_t g_zoneIndex[1 << 21];
+
+void BenchZoneQueries() {
+    // 5000 octagons of 50-300 m scattered over 100 x 100 km
+    for (uint32_t z = 0; z < ZONE_COUNT; ++z) {
+        const double north = RandRange(-50000.0, 50000.0);
+        const double east = RandRange(-50000.0, 50000.0);
+        const double size = RandRange(50.0, 300.0);
+        g_zoneCounts[z] = ZONE_POINTS;
+        for (uint16_t i = 0; i < ZONE_POINTS; ++i) {
+            const double angle = 2.0 * PI_VALUE * i / ZONE_POINTS;
+            g_zonePoints[z * ZONE_POINTS + i] = { (float)(north + size * std::cos(angle)), (float)(east + size * std::sin(angle)) };
+        }
+    }
+
+    uint8_t state = EResultState::OK;
+    PrepareZones(g_zonePoints, g_zoneCounts, nullptr, ZONE_COUNT, g_zoneIndex, sizeof(g_zoneIndex), &state);
+    if (state != EResultState::OK) {
+        std::printf("zones: PrepareZones failed (state %d)\n", (int)state);
+        return;
+    }
+
+    for (int coherent = 0; coherent < 2; ++coherent) {
+        const char* variant = coherent ? "coherent" : "random";
+        for (uint32_t i = 0; i < MAX_INPUTS; ++i) {
+            g_points[i] = coherent
+                ? SPointNE{ (float)(-40000.0 + 80.0 * i), (float)(-20000.0 + 40.0 * i) }
+                : SPointNE{ (float)RandRange(-50000.0, 50000.0), (float)RandRange(-50000.0, 50000.0) };
+            g_azimuths[i] = (float)RandRange(0.0, 360.0);
+        }
+
+        Bench("zones", "QueryZonesCircle", variant, ZONE_COUNT, MAX_INPUTS, [&]() {
+            for (uint32_t i = 0; i < MAX_INPUTS; ++i) {
+                uint32_t hitCount;
+                uint8_t st;
+                QueryZonesCircle(g_zoneIndex, g_points[i], 500.0f, g_zoneHits, ZONE_COUNT, &hitCount, &st);
+                g_sink += hitCount;
+            }
+        });
+        Bench("zones", "QueryZonesSegment", variant, ZONE_COUNT, MAX_INPUTS, [&]() {
+            for (uint32_t i = 0; i < MAX_INPUTS; ++i) {
+                uint32_t hitCount;
+                uint8_t st;
+                QueryZonesSegment(g_zoneIndex, g_points[i], g_azimuths[i], 2000.0f, g_zoneHits, ZONE_COUNT, &hitCount, &st);
+                g_sink += hitCount;
+            }
+        });
+        // Baseline: one isInsidePolygon call per zone
+        Bench("zones", "isInsidePolygon x zones", variant, ZONE_COUNT, 16, [&]() {
+            for (uint32_t i = 0; i < 16; ++i) {
+                for (uint32_t z = 0; z < ZONE_COUNT; ++z) {
+                    uint8_t res, st;
+                    isInsidePolygon(&g_zonePoints[z * ZONE_POINTS], ZONE_POINTS, g_points[i], 500.0f, &res, &st);
+                    g_sink += res;
+                }
+            }
+        });
+    }
+
+    // Re-originating every zone from its geodetic ring
+    const double originLat = 32.1, originLon = 34.8, originAlt = 0.0;
+    for (uint32_t i = 0; i < ZONE_COUNT * ZONE_POINTS; ++i) {
+        NedToGeo(originLat, originLon, originAlt, SPointNED{ g_zonePoints[i].north, g_zonePoints[i].east, 0.0 }, &g_zoneGeo[i]);
+    }
+    // Baseline: GeoToNed per vertex, narrowed by hand, then InitPolygonBounds
+    Bench("zones", "GeoToNed+InitBounds x zones", "geodetic", ZONE_COUNT, ZONE_COUNT, [&]() {
+        for (uint32_t z = 0; z < ZONE_COUNT; ++z) {
+            for (uint16_t i = 0; i < ZONE_POINTS; ++i) {
+                SPointNED ned;
+                GeoToNed(originLat, originLon, originAlt, g_zoneGeo[z * ZONE_POINTS + i], &ned);
+                g_zoneImported[z * ZONE_POINTS + i] = { (float)ned.north, (float)ned.east };
+            }
+            uint8_t st;
+            InitPolygonBounds(&g_zoneImported[z * ZONE_POINTS], ZONE_POINTS, &g_zoneBounds[z], &st);
+            g_sink += st;
+        }
+    });
+    Bench("zones", "ImportGeoPolygon x zones", "geodetic", ZONE_COUNT, ZONE_COUNT, [&]() {
+        for (uint32_t z = 0; z < ZONE_COUNT; ++z) {
+            uint16_t count;
+            uint8_t st;
+            ImportGeoPolygon(originLat, originLon, originAlt, &g_zoneGeo[z * ZONE_POINTS], ZONE_POINTS,
+                &g_zoneImported[z * ZONE_POINTS], ZONE_POINTS, &count, &g_zoneBounds[z], &st);
+            g_sink += count;
+        }
+    });
+}
+
+void BenchCoordsConversions() {
+    const double originLat = 32.1, originLon = 34.8, originAlt = 50.0;
+    uint8_t frameState;
+    SLocalFrame frame;
+    InitLocalFrame(originLat, originLon, originAlt, &frame, &frameState);
+    SLocalSeriesFrame seriesFrame;
+    InitLocalSeriesFrame(originLat, originLon, originAlt, &seriesFrame);
+
+    for (int coherent = 0; coherent < 2; ++coherent) {
+        const char* variant = coherent ? "coherent" : "random";
+
+        // Random: anywhere within +-0.5 deg of the origin; coherent: a straight track
+        for (uint32_t i = 0; i < MAX_INPUTS; ++i) {
+            g_geo[i] = coherent
+                ? SPointGeo{ originLat + 1e-4 * i, originLon + 2e-4 * i, originAlt + 0.5 * i }
+                : SPointGeo{ originLat + RandRange(-0.5, 0.5), originLon + RandRange(-0.5, 0.5), RandRange(0.0, 3000.0) };
+        }
+        uint8_t state;
+        GeoToNedBatch(originLat, originLon, originAlt, g_geo, MAX_INPUTS, 0, g_ned, 0, &state);
+        GeoToEcefArray(g_geo, MAX_INPUTS, g_ecef, ECoordsKernel::KERNEL_REFERENCE, &state);
+
+        Bench("coords", "GeoToNed", variant, 0, MAX_INPUTS, [&]() {
+            for (uint32_t i = 0; i < MAX_INPUTS; ++i) {
+                SPointNED ned;
+                GeoToNed(originLat, originLon, originAlt, g_geo[i], &ned);
+                g_sink += (uint64_t)(ned.north > 0.0);
+            }
+        });
+        Bench("coords", "NedToGeo", variant, 0, MAX_INPUTS, [&]() {
+            for (uint32_t i = 0; i < MAX_INPUTS; ++i) {
+                SPointGeo geo;
+                NedToGeo(originLat, originLon, originAlt, g_ned[i], &geo);
+                g_sink += (uint64_t)(geo.latitudeDeg > 0.0);
+            }
+        });
+        Bench("coords", "GeoToNedFrame", variant, 0, MAX_INPUTS, [&]() {
+            uint8_t st;
+            for (uint32_t i = 0; i < MAX_INPUTS; ++i) {
+                SPointNED ned;
+                GeoToNedFrame(&frame, g_geo[i], &ned, &st);
+                g_sink += (uint64_t)(ned.north > 0.0);
+            }
+        });
+        Bench("coords", "GeoToNedBatch", variant, 0, MAX_INPUTS, [&]() {
+            uint8_t st;
+            GeoToNedBatch(originLat, originLon, originAlt, g_geo, MAX_INPUTS, 0, g_ned, 0, &st);
+            g_sink += (uint64_t)(g_ned[0].north > 0.0);
+        });
+        Bench("coords", "NedToGeoBatch", variant, 0, MAX_INPUTS, [&]() {
+            uint8_t st;
+            NedToGeoBatch(originLat, originLon, originAlt, g_ned, MAX_INPUTS, 0, g_geo, 0, &st);
+            g_sink += (uint64_t)(g_geo[0].latitudeDeg > 0.0);
+        });
+        Bench("coords", "GeoToNedSeriesBatch", variant, 0, MAX_INPUTS, [&]() {
+            uint8_t st;
+            double maxError;
+            GeoToNedSeriesBatch(&seriesFrame, g_geo, MAX_INPUTS, 0, g_ned, 0, &maxError, &st);
+            g_sink += (uint64_t)(g_ned[0].north > 0.0);
+        });
+        Bench("coords", "NedToGeoSeriesBatch", variant, 0, MAX_INPUTS, [&]() {
+            uint8_t st;
+            double maxError;
+            NedToGeoSeriesBatch(&seriesFrame, g_ned, MAX_INPUTS, 0, g_geo, 0, &maxError, &st);
+            g_sink += (uint64_t)(g_geo[0].latitudeDeg > 0.0);
+        });
+
+        // Internal GeoToEcef / EcefToGeo: the reference kernel calls them once per point
+        const struct { uint8_t kernel; const char* name; } kernels[] = {
+            { ECoordsKernel::KERNEL_REFERENCE, "reference" },
+            { ECoordsKernel::KERNEL_SCALAR, "scalar" },
+            { ECoordsKernel::KERNEL_AVX2, "avx2" },
+            { ECoordsKernel::KERNEL_AVX512, "avx512" },
+        };
+        for (const auto& k : kernels) {
+            uint8_t st;
+            GeoToEcefArray(g_geo, 1, g_ecef, k.kernel, &st);
+            if (st != EResultState::OK) continue; // not supported on this CPU
+
+            char name[32];
+            std::snprintf(name, sizeof(name), "GeoToEcef[%s]", k.name);
+            Bench("coords", name, variant, 0, MAX_INPUTS, [&]() {
+                uint8_t s;
+                GeoToEcefArray(g_geo, MAX_INPUTS, g_ecef, k.kernel, &s);
+                g_sink += (uint64_t)(g_ecef[0].x > 0.0);
+            });
+            std::snprintf(name, sizeof(name), "EcefToGeo[%s]", k.name);
+            Bench("coords", name, variant, 0, MAX_INPUTS, [&]() {
+                uint8_t s;
+                EcefToGeoArray(g_ecef, MAX_INPUTS, g_geo, k.kernel, &s);
+                g_sink += (uint64_t)(g_geo[0].latitudeDeg > 0.0);
+            });
+        }
+    }
+}
+
+// Precision policies of the geometric kernels (inputs reuse the ring points)
+template <typename TPrecision>
+void BenchPrecisionPath(const char* variant) {
+    Bench("geometry", "getDistToSegmentSquared", variant, 0, MAX_INPUTS - 2, [&]() {
+        for (uint32_t i = 0; i + 2 < MAX_INPUTS; ++i) {
+            g_sink += (uint64_t)(getDistToSegmentSquared<TPrecision>(g_points[i], g_points[i + 1], g_points[i + 2]) > 1.0);
+        }
+    });
+    Bench("geometry", "doSegmentsIntersect", variant, 0, MAX_INPUTS - 3, [&]() {
+        for (uint32_t i = 0; i + 3 < MAX_INPUTS; ++i) {
+            g_sink += doSegmentsIntersect<TPrecision>(g_points[i], g_points[i + 1], g_points[i + 2], g_points[i + 3]);
+        }
+    });
+    Bench("geometry", "orientation", variant, 0, MAX_INPUTS - 2, [&]() {
+        for (uint32_t i = 0; i + 2 < MAX_INPUTS; ++i) {
+            g_sink += orientation<TPrecision>(g_points[i], g_points[i + 1], g_points[i + 2]);
+        }
+    });
+}
+
+void BenchGeometryKernels() {
+    BuildPoints(MAX_INPUTS, 0.0, POLY_OUTER_RADIUS, false, true);
+    BenchPrecisionPath<SFloatPrecision>("float");
+    BenchPrecisionPath<SDoublePrecision>("double");
+    BenchPrecisionPath<SRobustPrecision>("robust");
+
+    // Worst case of the robust path: every triple collinear up to rounding, so the filter never
+    // decides (points along a diagonal through a tiny offset to the origin)
+    for (uint32_t i = 0; i < MAX_INPUTS; ++i) {
+        const float c = (float)RandRange(1.0, POLY_OUTER_RADIUS);
+        g_points[i] = (i % 2 == 0) ? SPointNE{ c, c } : SPointNE{ (float)RandRange(-1e-20, 1e-20), (float)RandRange(-1e-20, 1e-20) };
+    }
+    BenchPrecisionPath<SDoublePrecision>("double/collinear");
+    BenchPrecisionPath<SRobustPrecision>("robust/collinear");
+}
+
+// EcefToGeo algorithms on the same points (the NED -> Geo path is bound by this step)
+void BenchEcefToGeoMethods() {
+    const struct { uint8_t method; const char* name; } methods[] = {
+        { EEcefToGeoMethod::ECEF_TO_GEO_BOWRING, "EcefToGeo[bowring]" },
+        { EEcefToGeoMethod::ECEF_TO_GEO_VERMEILLE, "EcefToGeo[vermeille]" },
+        { EEcefToGeoMethod::ECEF_TO_GEO_OLSON, "EcefToGeo[olson]" },
+    };
+
+    for (uint32_t i = 0; i < MAX_INPUTS; ++i) {
+        g_geo[i] = { RandRange(-90.0, 90.0), RandRange(-180.0, 180.0), RandRange(-1000.0, 100000.0) };
+    }
+    uint8_t state;
+    GeoToEcefArray(g_geo, MAX_INPUTS, g_ecef, ECoordsKernel::KERNEL_REFERENCE, &state);
+
+    for (const auto& m : methods) {
+        Bench("coords", m.name, "-1..100 km", 0, MAX_INPUTS, [&]() {
+            uint8_t st;
+            EcefToGeoArrayMethod(g_ecef, MAX_INPUTS, g_geo, m.method, &st);
+            g_sink += (uint64_t)(g_geo[0].latitudeDeg > 0.0);
+        });
+    }
+}
+
+// --- Output ---
+
+bool WriteCsv(const char* path) {
+    FILE* file = std::fopen(path, "w");
+    if (file == nullptr) return false;
+    std::fprintf(file, "group,function,variant,vertices,ns_per_op,ops_per_sec\n");
+    for (uint32_t r = 0; r < g_rowCount; ++r) {
+        const SBenchRow& row = g_rows[r];
+        std::fprintf(file, "%s,%s,%s,%u,%.3f,%.1f\n", row.group, row.function, row.variant, row.vertices, row.nsPerOp, row.opsPerSec);
+    }
+    std::fclose(file);
+    return true;
+}
+
+bool WriteJson(const char* path) {
+    FILE* file = std::fopen(path, "w");
+    if (file == nullptr) return false;
+    std::fprintf(file, "[\n");
+    for (uint32_t r = 0; r < g_rowCount; ++r) {
+        const SBenchRow& row = g_rows[r];
+        std::fprintf(file, "  {\"group\": \"%s\", \"function\": \"%s\", \"variant\": \"%s\", \"vertices\": %u, \"ns_per_op\": %.3f, \"ops_per_sec\": %.1f}%s\n",
+            row.group, row.function, row.variant, row.vertices, row.nsPerOp, row.opsPerSec, (r + 1 < g_rowCount) ? "," : "");
+    }
+    std::fprintf(file, "]\n");
+    std::fclose(file);
+    return true;
+}
+
+// Scaling of the *Parallel batches from 1 thread to g_maxThreads (powers of two, then the maximum)
+const uint32_t SCALE_GEO_POINTS = 1u << 20;
+const uint32_t SCALE_INSIDE_POINTS = 100000;
+const uint16_t SCALE_POLYGON_VERTICES = 256;
+SPointGeo g_scaleGeo[SCALE_GEO_POINTS];
+SPointNED g_scaleNed[SCALE_GEO_POINTS];
+SPointNE g_scalePoints[SCALE_INSIDE_POINTS];
+uint8_t g_scaleFlags[SCALE_INSIDE_POINTS];
+alignas(64) uint8_t g_pool[1 << 14];
+uint32_t g_maxThreads = 0;
+
+void BenchParallelScaling() {
+    const double originLat = 32.1, originLon = 34.8, originAlt = 50.0;
+    for (uint32_t i = 0; i < SCALE_GEO_POINTS; ++i) {
+        g_scaleGeo[i] = { originLat + RandRange(-0.5, 0.5), originLon + RandRange(-0.5, 0.5), RandRange(0.0, 10000.0) };
+    }
+    BuildPolygon(SCALE_POLYGON_VERTICES);
+    for (uint32_t i = 0; i < SCALE_INSIDE_POINTS; ++i) {
+        g_scalePoints[i] = { (float)RandRange(-2.0 * POLY_OUTER_RADIUS, 2.0 * POLY_OUTER_RADIUS), (float)RandRange(-2.0 * POLY_OUTER_RADIUS, 2.0 * POLY_OUTER_RADIUS) };
+    }
+
+    uint32_t maxThreads = (g_maxThreads > 0) ? g_maxThreads : std::thread::hardware_concurrency();
+    maxThreads = MAX(1u, MIN(maxThreads, 64u));
+
+    for (uint32_t threads = 1; ; threads = MIN(threads * 2, maxThreads)) {
+        uint8_t state;
+        WorkerPoolInit(g_pool, sizeof(g_pool), threads, &state);
+        if (state != EResultState::OK) {
+            std::printf("WorkerPoolInit failed for %u threads (state %u)\n", threads, state);
+            return;
+        }
+
+        char variant[24];
+        std::snprintf(variant, sizeof(variant), "%u threads", threads);
+        Bench("parallel", "GeoToNedBatchParallel", variant, 0, SCALE_GEO_POINTS, [&]() {
+            uint8_t st;
+            GeoToNedBatchParallel(g_pool, originLat, originLon, originAlt, g_scaleGeo, SCALE_GEO_POINTS, 0, g_scaleNed, 0, &st);
+            g_sink += (uint64_t)(g_scaleNed[0].north > 0.0);
+        });
+        Bench("parallel", "isInsidePolygonBatchParallel", variant, SCALE_POLYGON_VERTICES, SCALE_INSIDE_POINTS, [&]() {
+            uint8_t st;
+            isInsidePolygonBatchParallel(g_pool, g_polygon, SCALE_POLYGON_VERTICES, g_scalePoints, SCALE_INSIDE_POINTS, nullptr, 1.0f, g_scaleFlags, &st);
+            g_sink += g_scaleFlags[0];
+        });
+
+        WorkerPoolShutdown(g_pool, &state);
+        if (threads == maxThreads) break;
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* csvPath = nullptr;
+    const char* jsonPath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) g_minSeconds = 0.02;
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) g_maxThreads = (uint32_t)std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc) csvPath = argv[++i];
+        else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) jsonPath = argv[++i];
+        else {
+            std::printf("Usage: %s [--quick] [--threads <max>] [--csv <file>] [--json <file>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::printf("%-10s %-26s %-18s %8s %14s %16s\n", "group", "function", "variant", "vertices", "ns/op", "ops/s");
+    BenchGeometryKernels();
+    BenchPolygonQueries();
+    BenchConvexQueries();
+    BenchMultiRingQueries();
+    BenchRouteQueries();
+    BenchZoneQueries();
+    BenchCoordsConversions();
+    BenchEcefToGeoMethods();
+    BenchParallelScaling();
+
+    if (csvPath != nullptr && !WriteCsv(csvPath)) {
+        std::printf("Failed to write %s\n", csvPath);
+        return 1;
+    }
+    if (jsonPath != nullptr && !WriteJson(jsonPath)) {
+        std::printf("Failed to write %s\n", jsonPath);
+        return 1;
+    }
+    return 0;
+}
@@ -84,4 +84,923 @@ extern "C" {
 		const SPointNED nedPoint,
 		SPointGeo* resGeoPoint
 	);
-}
\ No newline at end of file
+
+	/**
+	 * @brief Converts an array of geodetic points to NED around a single origin.
+	 *
+	 * The origin frame (rotation matrix and origin ECEF position) is computed once
+	 * per call and reused for every point. No memory is allocated; all buffers are caller-owned.
+	 *
+	 * @param[in]  geoPoints      Pointer to the first input point.
+	 * @param[in]  pointCount     Number of points to convert.
+	 * @param[in]  inStrideBytes  Distance in bytes between consecutive input points (0 = sizeof(SPointGeo)).
+	 * @param[out] resNedPoints   Pointer to the first output slot (pointCount slots).
+	 * @param[in]  outStrideBytes Distance in bytes between consecutive output slots (0 = sizeof(SPointNED)).
+	 * @param[out] resultState    EResultState (POINTS_IS_NULL_PTR if an array pointer is null,
+	 *                            STRIDE_TOO_SMALL for a nonzero stride below the record size).
+	 *
+	 * @note Each point goes through the reference (libm) conversions, so results are bit-identical
+	 *       to GeoToNed. The faster approximate kernels are only used by GeoToEcefArray / EcefToGeoArray.
+	 */
+	API_FUNCTIONS void GeoToNedBatch(
+		const double originLatitudeDeg,
+		const double originLongitudeDeg,
+		const double originAltitude,
+		const SPointGeo* geoPoints,
+		uint32_t pointCount,
+		uint32_t inStrideBytes,
+		SPointNED* resNedPoints,
+		uint32_t outStrideBytes,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Converts an array of NED points around a single origin to geodetic.
+	 *
+	 * Batch counterpart of NedToGeo, see GeoToNedBatch for buffer and stride semantics.
+	 * Results are bit-identical to NedToGeo.
+	 */
+	API_FUNCTIONS void NedToGeoBatch(
+		const double originLatitudeDeg,
+		const double originLongitudeDeg,
+		const double originAltitude,
+		const SPointNED* nedPoints,
+		uint32_t pointCount,
+		uint32_t inStrideBytes,
+		SPointGeo* resGeoPoints,
+		uint32_t outStrideBytes,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Fills a caller-owned local frame for a fixed origin.
+	 *
+	 * The frame holds the origin ECEF position and both NED<->ECEF rotations, so the
+	 * *Frame conversions below skip the per-call origin setup done by GeoToNed / NedToGeo.
+	 *
+	 * @param[out] frame       Frame to initialize.
+	 * @param[out] resultState EResultState (BUFFER_IS_NULL_PTR for a null frame).
+	 */
+	API_FUNCTIONS void InitLocalFrame(
+		const double originLatitudeDeg,
+		const double originLongitudeDeg,
+		const double originAltitude,
+		SLocalFrame* frame,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief GeoToNed against a frame previously filled by InitLocalFrame.
+	 *
+	 * @param[out] resultState EResultState (BUFFER_IS_NULL_PTR for a null frame,
+	 *                         POINTS_IS_NULL_PTR for a null resNedPoint).
+	 */
+	API_FUNCTIONS void GeoToNedFrame(
+		const SLocalFrame* frame,
+		const SPointGeo geoPoint,
+		SPointNED* resNedPoint,
+		uint8_t* resultState // EResultState
+	);
+
+	/** @brief NedToGeo against a frame previously filled by InitLocalFrame, errors as GeoToNedFrame. */
+	API_FUNCTIONS void NedToGeoFrame(
+		const SLocalFrame* frame,
+		const SPointNED nedPoint,
+		SPointGeo* resGeoPoint,
+		uint8_t* resultState // EResultState
+	);
+
+	/** @brief ECEF to NED against a frame previously filled by InitLocalFrame, errors as GeoToNedFrame. */
+	API_FUNCTIONS void EcefToNedFrame(
+		const SLocalFrame* frame,
+		const SPointECEF ecefPoint,
+		SPointNED* resNedPoint,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Converts an array of geodetic points to ECEF with a selectable kernel.
+	 *
+	 * @param[in]  kernel      ECoordsKernel. KERNEL_AUTO picks the fastest kernel the CPU supports.
+	 * @param[out] resultState EResultState (KERNEL_NOT_SUPPORTED if the CPU lacks the requested ISA).
+	 */
+	API_FUNCTIONS void GeoToEcefArray(
+		const SPointGeo* geoPoints,
+		uint32_t pointCount,
+		SPointECEF* resEcefPoints,
+		uint8_t kernel,		 // ECoordsKernel
+		uint8_t* resultState // EResultState
+	);
+
+	/** @brief Converts an array of ECEF points to geodetic, see GeoToEcefArray. */
+	API_FUNCTIONS void EcefToGeoArray(
+		const SPointECEF* ecefPoints,
+		uint32_t pointCount,
+		SPointGeo* resGeoPoints,
+		uint8_t kernel,		 // ECoordsKernel
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Converts an array of ECEF points to geodetic with a selectable algorithm.
+	 *
+	 * Vermeille and Olson stay at rounding level (3e-14 deg, 5e-9 m) from -1 km to +100 km
+	 * altitude; Bowring (EcefToGeo) loses accuracy with altitude (9e-5 m at 100 km).
+	 *
+	 * @param[in]  method      EEcefToGeoMethod.
+	 * @param[out] resultState EResultState (METHOD_NOT_SUPPORTED for an unknown method).
+	 */
+	API_FUNCTIONS void EcefToGeoArrayMethod(
+		const SPointECEF* ecefPoints,
+		uint32_t pointCount,
+		SPointGeo* resGeoPoints,
+		uint8_t method,		 // EEcefToGeoMethod
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief NedToGeoFrame with a selectable ECEF -> geodetic algorithm, see EcefToGeoArrayMethod.
+	 *
+	 * @param[out] resultState EResultState (BUFFER_IS_NULL_PTR for a null frame, POINTS_IS_NULL_PTR
+	 *                         for a null resGeoPoint, METHOD_NOT_SUPPORTED for an unknown method).
+	 */
+	API_FUNCTIONS void NedToGeoFrameMethod(
+		const SLocalFrame* frame,
+		const SPointNED nedPoint,
+		uint8_t method,		 // EEcefToGeoMethod
+		SPointGeo* resGeoPoint,
+		uint8_t* resultState // EResultState
+	);
+
+	/** @brief Reports the kernel KERNEL_AUTO resolves to on this CPU. */
+	API_FUNCTIONS void GetActiveCoordsKernel(
+		uint8_t* outKernel // ECoordsKernel
+	);
+
+	/**
+	 * @brief Reports the buffer size PreparePolygon needs for a polygon.
+	 *
+	 * @param[out] outSizeBytes Required size in bytes (0 on error).
+	 * @param[out] resultState  EResultState (INDEX_TOO_LARGE if the index would exceed 4 GB).
+	 */
+	API_FUNCTIONS void GetPreparedPolygonSize(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		uint32_t* outSizeBytes,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Builds a query index for a polygon into a caller-supplied buffer.
+	 *
+	 * The buffer receives a copy of the vertices plus East-axis slabs and a uniform grid of
+	 * edge buckets. It must be 8-byte aligned and at least GetPreparedPolygonSize bytes.
+	 * The buffer is self-contained: the original polygon may be released afterwards.
+	 */
+	API_FUNCTIONS void PreparePolygon(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		uint8_t* buffer,
+		uint32_t bufferSize,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief isInsidePolygon against a polygon prepared by PreparePolygon.
+	 *
+	 * Returns exactly what isInsidePolygon returns for the same polygon, point and radius,
+	 * but only visits the edges in the test point's East slab and in the grid cells
+	 * the circle can reach.
+	 *
+	 * @param[in] prepared Buffer filled by PreparePolygon.
+	 */
+	API_FUNCTIONS void isInsidePolygonPrepared(
+		const uint8_t* prepared,
+		const SPointNE testPoint,
+		float radiusMeters,
+		uint8_t* outResult,	 // bool
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief isInsidePolygon for many test points against one polygon.
+	 *
+	 * The polygon is validated once and walked edge-major: each edge is loaded once per
+	 * block of 64 test points. Every result equals isInsidePolygon for that point.
+	 *
+	 * @param[in]  testPoints     Array of testPointCount circle centers.
+	 * @param[in]  radiiMeters    Optional per-point radii (testPointCount entries); nullptr uses radiusMeters.
+	 * @param[in]  radiusMeters   Radius applied to every point when radiiMeters is nullptr.
+	 * @param[out] outResults     One bool per test point.
+	 * @param[out] resultState    Aggregate EResultState for the whole batch.
+	 */
+	API_FUNCTIONS void isInsidePolygonBatch(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SPointNE* testPoints,
+		uint32_t testPointCount,
+		const float* radiiMeters,
+		float radiusMeters,
+		uint8_t* outResults, // bool[testPointCount]
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Same as isInsidePolygonBatch with bit-packed results.
+	 *
+	 * @param[out] outBits Result of test point i in bit (i % 8) of byte (i / 8); (testPointCount + 7) / 8 bytes.
+	 */
+	API_FUNCTIONS void isInsidePolygonBatchBits(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SPointNE* testPoints,
+		uint32_t testPointCount,
+		const float* radiiMeters,
+		float radiusMeters,
+		uint8_t* outBits,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Computes the buffer size PrepareZones needs for a set of zones.
+	 *
+	 * @param[in]  zonePointCounts Number of vertices of each zone.
+	 * @param[in]  zoneCount       Number of zones.
+	 * @param[out] outSizeBytes    Required buffer size in bytes.
+	 * @param[out] resultState     EResultState (INDEX_TOO_LARGE if the index would exceed 4 GB).
+	 */
+	API_FUNCTIONS void GetPreparedZonesSize(
+		const uint16_t* zonePointCounts,
+		uint32_t zoneCount,
+		uint32_t* outSizeBytes,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Builds a multi-zone index (bounding-volume hierarchy) into a caller-owned buffer.
+	 *
+	 * All zone polygons are copied, so the inputs may be released afterwards.
+	 * With the index a query only runs the exact test on zones whose bounding box is near the query.
+	 *
+	 * @param[in]  zonePoints      Vertices of all zones, back to back.
+	 * @param[in]  zonePointCounts Number of vertices of each zone (at least 3).
+	 * @param[in]  zoneIds         ID reported for each zone, or nullptr to report the zone's position.
+	 * @param[in]  zoneCount       Number of zones.
+	 * @param[out] buffer          8-byte aligned buffer of at least GetPreparedZonesSize bytes.
+	 * @param[in]  bufferSize      Size of buffer in bytes.
+	 * @param[out] resultState     EResultState.
+	 */
+	API_FUNCTIONS void PrepareZones(
+		const SPointNE* zonePoints,
+		const uint16_t* zonePointCounts,
+		const uint32_t* zoneIds,
+		uint32_t zoneCount,
+		uint8_t* buffer,
+		uint32_t bufferSize,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief IDs of the zones a point or circle collides with (isInsidePolygon semantics per zone).
+	 *
+	 * Use radiusMeters = 0 for a point query.
+	 *
+	 * @param[in]  preparedZones Buffer filled by PrepareZones.
+	 * @param[out] outZoneIds    Receives up to maxZoneIds IDs (may be nullptr if maxZoneIds is 0).
+	 * @param[out] outCount      Total number of zones hit, even when larger than maxZoneIds.
+	 * @param[out] resultState   EResultState (OUTPUT_TOO_SMALL if outCount > maxZoneIds).
+	 */
+	API_FUNCTIONS void QueryZonesCircle(
+		const uint8_t* preparedZones,
+		const SPointNE testPoint,
+		float radiusMeters,
+		uint32_t* outZoneIds,
+		uint32_t maxZoneIds,
+		uint32_t* outCount,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief IDs of the zones a segment collides with (doesLineIntersectPolygon semantics per zone).
+	 *
+	 * Zones are pre-selected by bounding box; near-collinear edges whose rounding noise
+	 * makes doSegmentsIntersect report a hit far from the segment are not reported.
+	 * Same output convention as QueryZonesCircle.
+	 */
+	API_FUNCTIONS void QueryZonesSegment(
+		const uint8_t* preparedZones,
+		const SPointNE testPoint,
+		float azimuthDegrees,
+		float maxLength,
+		uint32_t* outZoneIds,
+		uint32_t maxZoneIds,
+		uint32_t* outCount,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief First boundary contact of a ray with a polygon.
+	 *
+	 * isHit matches doesLineIntersectPolygon for the same start, azimuth and length; on a hit the
+	 * distance along the ray, the edge touched first and the contact point are reported as well.
+	 * A start point inside the polygon is a hit at distance 0 with edgeIndex 0xFFFF.
+	 *
+	 * @param[in]  ray         Start point, azimuth and maximum length (must be positive).
+	 * @param[out] outHit      First contact.
+	 * @param[out] resultState EResultState (outHit is a hit at distance 0 on error).
+	 */
+	API_FUNCTIONS void getFirstRayHit(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SRayNE ray,
+		SRayHit* outHit,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief getFirstRayHit for many rays against one polygon.
+	 *
+	 * Rays with a non-positive length report a hit at distance 0 and make the aggregate
+	 * state MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO; the other rays are still evaluated.
+	 *
+	 * @param[in]  rays        Array of rayCount rays.
+	 * @param[out] outHits     Array of rayCount results.
+	 * @param[out] resultState Aggregate EResultState.
+	 */
+	API_FUNCTIONS void getFirstRayHitBatch(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SRayNE* rays,
+		uint32_t rayCount,
+		SRayHit* outHits,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief getFirstRayHit on a polygon prepared with PreparePolygon.
+	 *
+	 * Only the edges in the grid cells along the ray are tested. Edges are found through the cells
+	 * they share with the ray, so near-collinear edges that doSegmentsIntersect reports as hit
+	 * only through rounding, away from the ray, are not reported.
+	 */
+	API_FUNCTIONS void getFirstRayHitPrepared(
+		const uint8_t* prepared,
+		const SRayNE ray,
+		SRayHit* outHit,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief isInsidePolygon plus the clearance margin, in a single pass over the edges.
+	 *
+	 * The crossing parity and the minimum distance to the boundary are accumulated together.
+	 * isCollision equals isInsidePolygon; signedDistance is negative when the center is inside,
+	 * and clearance = signedDistance - |radiusMeters| is the free margin left to the boundary.
+	 *
+	 * @param[out] outClearance Result, see SPolygonClearance.
+	 * @param[out] resultState  EResultState (outClearance->isCollision is true on error).
+	 */
+	API_FUNCTIONS void getPolygonClearance(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SPointNE testPoint,
+		float radiusMeters,
+		SPolygonClearance* outClearance,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Computes the bounding box and bounding circle of a polygon into caller memory.
+	 *
+	 * @param[out] outBounds   Descriptor for isInsidePolygonBounded / doesLineIntersectPolygonBounded.
+	 * @param[out] resultState EResultState.
+	 */
+	API_FUNCTIONS void InitPolygonBounds(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		SPolygonBounds* outBounds,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief isInsidePolygon that first rejects circles far from the polygon in O(1).
+	 *
+	 * Circles clear of the bounding box or bounding circle (plus a small rounding margin) are
+	 * answered false without visiting the edges; all others go to isInsidePolygon.
+	 *
+	 * @param[in] bounds Descriptor filled by InitPolygonBounds for this polygon.
+	 */
+	API_FUNCTIONS void isInsidePolygonBounded(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SPolygonBounds* bounds,
+		const SPointNE testPoint,
+		float radiusMeters,
+		uint8_t* outResult,	 // bool
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief doesLineIntersectPolygon that first rejects segments far from the polygon in O(1).
+	 *
+	 * A near-collinear edge that doSegmentsIntersect reports as hit only through rounding,
+	 * away from the segment, is not reported.
+	 *
+	 * @param[in] bounds Descriptor filled by InitPolygonBounds for this polygon.
+	 */
+	API_FUNCTIONS void doesLineIntersectPolygonBounded(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SPolygonBounds* bounds,
+		const SPointNE testPoint,
+		float azimuthDegrees,
+		float maxLength,
+		uint8_t* outResult,	 // bool
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Starts an empty scratch arena over caller memory.
+	 *
+	 * The arena never touches the heap; the buffer must outlive every pointer handed out.
+	 *
+	 * @param[out] arena       Arena state (caller-owned).
+	 * @param[in]  buffer      Backing memory (any alignment).
+	 * @param[in]  bufferSize  Size of buffer in bytes.
+	 * @param[out] resultState EResultState.
+	 */
+	API_FUNCTIONS void ArenaInit(
+		SArena* arena,
+		uint8_t* buffer,
+		uint32_t bufferSize,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Bump-allocates sizeBytes from the arena.
+	 *
+	 * @param[in]  alignment   Power of two up to 4096 (BUFFER_NOT_ALIGNED otherwise).
+	 * @param[out] outPtr      Start of the block, or nullptr when it does not fit (BUFFER_TOO_SMALL).
+	 * @param[out] resultState EResultState.
+	 */
+	API_FUNCTIONS void ArenaAlloc(
+		SArena* arena,
+		uint32_t sizeBytes,
+		uint32_t alignment,
+		uint8_t** outPtr,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Current arena position, to be passed to ArenaRewind later.
+	 */
+	API_FUNCTIONS void ArenaMark(
+		const SArena* arena,
+		uint32_t* outMark,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Releases every block allocated after mark was taken.
+	 *
+	 * A mark past the current position is rejected with ARENA_MARK_INVALID.
+	 */
+	API_FUNCTIONS void ArenaRewind(
+		SArena* arena,
+		uint32_t mark,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Largest number of bytes the arena has held at once since ArenaInit (padding included).
+	 */
+	API_FUNCTIONS void ArenaHighWater(
+		const SArena* arena,
+		uint32_t* outBytes,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Bytes of caller memory a worker pool needs (any thread count).
+	 */
+	API_FUNCTIONS void GetWorkerPoolSize(
+		uint32_t* outSizeBytes,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Starts a fixed pool of threadCount workers inside caller memory.
+	 *
+	 * The calling thread of each *Parallel function is one of the workers, so threadCount - 1
+	 * native threads are started here and nothing is allocated afterwards. Call
+	 * WorkerPoolShutdown before releasing or re-initializing the buffer.
+	 *
+	 * @param[in]  buffer      GetWorkerPoolSize bytes, 8-byte aligned.
+	 * @param[in]  threadCount 1 .. 64 (THREAD_COUNT_INVALID otherwise).
+	 * @param[out] resultState EResultState (THREAD_START_FAILED if the OS refuses a thread,
+	 *                         POOL_ALREADY_STARTED if buffer holds a pool not shut down yet).
+	 */
+	API_FUNCTIONS void WorkerPoolInit(
+		uint8_t* buffer,
+		uint32_t bufferSize,
+		uint32_t threadCount,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Stops and joins the pool threads.
+	 */
+	API_FUNCTIONS void WorkerPoolShutdown(
+		uint8_t* pool,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief GeoToNedBatch split across the workers of a pool.
+	 *
+	 * Each worker converts one contiguous range starting on a 64-point chunk boundary, so the
+	 * output is bit-identical to GeoToNedBatch for any thread count.
+	 *
+	 * @param[in] pool Buffer started by WorkerPoolInit (PREPARED_DATA_INVALID otherwise).
+	 */
+	API_FUNCTIONS void GeoToNedBatchParallel(
+		uint8_t* pool,
+		const double originLatitudeDeg,
+		const double originLongitudeDeg,
+		const double originAltitude,
+		const SPointGeo* geoPoints,
+		uint32_t pointCount,
+		uint32_t inStrideBytes,
+		SPointNED* resNedPoints,
+		uint32_t outStrideBytes,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief NedToGeoBatch split across the workers of a pool (see GeoToNedBatchParallel).
+	 */
+	API_FUNCTIONS void NedToGeoBatchParallel(
+		uint8_t* pool,
+		const double originLatitudeDeg,
+		const double originLongitudeDeg,
+		const double originAltitude,
+		const SPointNED* nedPoints,
+		uint32_t pointCount,
+		uint32_t inStrideBytes,
+		SPointGeo* resGeoPoints,
+		uint32_t outStrideBytes,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief isInsidePolygonBatch split across the workers of a pool.
+	 *
+	 * Ranges start on 64-point block boundaries; results equal isInsidePolygonBatch.
+	 */
+	API_FUNCTIONS void isInsidePolygonBatchParallel(
+		uint8_t* pool,
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SPointNE* testPoints,
+		uint32_t testPointCount,
+		const float* radiiMeters,
+		float radiusMeters,
+		uint8_t* outResults,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Checks a route of waypoints against a polygon and reports the first violation.
+	 *
+	 * Leg k runs straight from waypoints[k] to waypoints[k + 1]. The route violates the polygon
+	 * if its first waypoint is inside (isInsidePolygon, radius 0) or if a leg touches an edge
+	 * (doSegmentsIntersect, as in doesLineIntersectPolygon). The inside/outside state is carried
+	 * from leg to leg, so only the first waypoint is ray-cast and no azimuth or end point is
+	 * recomputed with cos/sin.
+	 *
+	 * @param[in]  waypoints     waypointCount route points (at least 2).
+	 * @param[out] outViolation  First violating leg and contact parameter, see SRouteViolation.
+	 * @param[out] resultState   EResultState (outViolation->isViolation is true on error).
+	 */
+	API_FUNCTIONS void doesRouteIntersectPolygon(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SPointNE* waypoints,
+		uint32_t waypointCount,
+		SRouteViolation* outViolation,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Starts a tracker for one moving point against one polygon.
+	 *
+	 * @param[out] outTracker  Caller-owned state for isInsidePolygonTracked.
+	 * @param[out] resultState EResultState.
+	 */
+	API_FUNCTIONS void InitPolygonTracker(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		SPolygonTracker* outTracker,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief isInsidePolygon for a point that moves a little between calls.
+	 *
+	 * The distance to the boundary changes by at most the displacement since the last full
+	 * evaluation, so while the point stays clear of the boundary the previous answer is kept
+	 * after an O(1) displacement-versus-clearance test. Near the boundary a full pass over the
+	 * edges answers and refreshes the tracker. Results equal isInsidePolygon.
+	 *
+	 * @param[in,out] tracker Filled by InitPolygonTracker for this polygon.
+	 */
+	API_FUNCTIONS void isInsidePolygonTracked(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		SPolygonTracker* tracker,
+		const SPointNE testPoint,
+		float radiusMeters,
+		uint8_t* outResult,	 // bool
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Fills the coefficients of the small-area series conversions for a fixed origin.
+	 *
+	 * @param[out] frame Frame to initialize (nothing is done when null).
+	 */
+	API_FUNCTIONS void InitLocalSeriesFrame(
+		const double originLatitudeDeg,
+		const double originLongitudeDeg,
+		const double originAltitude,
+		SLocalSeriesFrame* frame
+	);
+
+	/**
+	 * @brief Approximate GeoToNedBatch for points near the origin (no trigonometry per point).
+	 *
+	 * Evaluates a second-order series in dLat / dLon / dAlt around the origin. Each point gets a
+	 * worst-case distance to the exact GeoToNed; the largest is returned, so the caller can
+	 * re-run the batch with GeoToNedBatch when it exceeds the accuracy budget. The bound is
+	 * about 0.1 m at 20 km from an equatorial origin (3 cm measured), 1.3e-5 m at 1 km, and
+	 * grows with distance^3 / cos^2(lat0), see coords_conv_functions.h.
+	 *
+	 * @param[in]  frame             Filled by InitLocalSeriesFrame.
+	 * @param[out] outMaxErrorMeters Worst-case error over the batch (m); infinite when a point
+	 *                               is more than 0.1 rad of latitude or longitude from the origin.
+	 * @param[out] resultState       EResultState (BUFFER_IS_NULL_PTR for a null frame,
+	 *                               POINTS_IS_NULL_PTR if an array pointer or outMaxErrorMeters is null,
+	 *                               STRIDE_TOO_SMALL as in GeoToNedBatch).
+	 */
+	API_FUNCTIONS void GeoToNedSeriesBatch(
+		const SLocalSeriesFrame* frame,
+		const SPointGeo* geoPoints,
+		uint32_t pointCount,
+		uint32_t inStrideBytes,
+		SPointNED* resNedPoints,
+		uint32_t outStrideBytes,
+		double* outMaxErrorMeters,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Approximate NedToGeoBatch, the inverse of GeoToNedSeriesBatch with the same bound
+	 * (distance in meters between the returned point and the exact NedToGeo).
+	 */
+	API_FUNCTIONS void NedToGeoSeriesBatch(
+		const SLocalSeriesFrame* frame,
+		const SPointNED* nedPoints,
+		uint32_t pointCount,
+		uint32_t inStrideBytes,
+		SPointGeo* resGeoPoints,
+		uint32_t outStrideBytes,
+		double* outMaxErrorMeters,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Worst-case error of the series conversions for a point at the given horizontal
+	 * distance and altitude difference from the origin, to choose exact or series up front.
+	 * A null frame gives an infinite error, i.e. use the exact conversions.
+	 */
+	API_FUNCTIONS void GetLocalSeriesErrorBound(
+		const SLocalSeriesFrame* frame,
+		double horizontalDistanceMeters,
+		double altitudeDeltaMeters,
+		double* outErrorMeters
+	);
+
+	/**
+	 * @brief Converts a geodetic zone ring into a query-ready NE polygon and its bounds.
+	 *
+	 * One pass over the ring converts each vertex around the origin (as GeoToNedBatch), narrows
+	 * it to SPointNE and drops repeated and collinear vertices (a closing copy of the first vertex
+	 * included). The result is wound clockwise on a north-up map, and outBounds is filled as by
+	 * InitPolygonBounds, so the polygon can go straight to the query functions.
+	 *
+	 * @param[out] outPolygon     Receives the cleaned vertices; outCapacity must be at least ringCount.
+	 * @param[out] outPointCount  Number of vertices written.
+	 * @param[out] outBounds      Descriptor for the *Bounded queries.
+	 * @param[out] resultState    EResultState (POLYGON_WITH_LESS_THAN_3_POINTS also when the
+	 *                            cleaned ring degenerates to a point or a line).
+	 */
+	API_FUNCTIONS void ImportGeoPolygon(
+		const double originLatitudeDeg,
+		const double originLongitudeDeg,
+		const double originAltitude,
+		const SPointGeo* ring,
+		uint16_t ringCount,
+		SPointNE* outPolygon,
+		uint16_t outCapacity,
+		uint16_t* outPointCount,
+		SPolygonBounds* outBounds,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief GeoToNedBatch over separate, strided double columns (zero-copy from NumPy).
+	 *
+	 * Point i is read from latitudeDeg / longitudeDeg / altitude at byte offset i * inStrideBytes
+	 * and written to north / east / down at i * outStrideBytes (0 = sizeof(double), i.e. separate
+	 * contiguous arrays). Fields of a packed record array work too: pass the field addresses and
+	 * the record size as the stride. Results equal GeoToNedBatch.
+	 *
+	 * @param[out] resultState EResultState (POINTS_IS_NULL_PTR if a column pointer is null,
+	 *                         STRIDE_TOO_SMALL for a nonzero stride below sizeof(double)).
+	 */
+	API_FUNCTIONS void GeoToNedColumns(
+		const double originLatitudeDeg,
+		const double originLongitudeDeg,
+		const double originAltitude,
+		const double* latitudeDeg,
+		const double* longitudeDeg,
+		const double* altitude,
+		uint32_t pointCount,
+		uint32_t inStrideBytes,
+		double* north,
+		double* east,
+		double* down,
+		uint32_t outStrideBytes,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief NedToGeoBatch over strided double columns, see GeoToNedColumns.
+	 */
+	API_FUNCTIONS void NedToGeoColumns(
+		const double originLatitudeDeg,
+		const double originLongitudeDeg,
+		const double originAltitude,
+		const double* north,
+		const double* east,
+		const double* down,
+		uint32_t pointCount,
+		uint32_t inStrideBytes,
+		double* latitudeDeg,
+		double* longitudeDeg,
+		double* altitude,
+		uint32_t outStrideBytes,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief isInsidePolygonBatch with the test points given as strided double columns.
+	 *
+	 * Coordinates are narrowed to float as when building SPointNE; results equal isInsidePolygon
+	 * for each narrowed point.
+	 *
+	 * @param[out] outResults One bool per test point (contiguous).
+	 */
+	API_FUNCTIONS void isInsidePolygonColumns(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const double* testNorth,
+		const double* testEast,
+		uint32_t testPointCount,
+		uint32_t inStrideBytes,
+		float radiusMeters,
+		uint8_t* outResults, // bool[testPointCount]
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief doesLineIntersectPolygon for many lines given as strided double columns.
+	 *
+	 * Each line gives the same result as doesLineIntersectPolygon. A line with a non-positive length
+	 * gets true and sets resultState to MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO; the others are still evaluated.
+	 */
+	API_FUNCTIONS void doesLineIntersectPolygonColumns(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const double* startNorth,
+		const double* startEast,
+		const double* azimuthDegrees,
+		const double* maxLengthMeters,
+		uint32_t lineCount,
+		uint32_t inStrideBytes,
+		uint8_t* outResults, // bool[lineCount]
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief Detects whether a polygon is convex, into caller memory.
+	 *
+	 * Convex zones (boxes, corridors, imported circles) can then use the *Convex queries.
+	 * A polygon with a zero-length edge, a reflex vertex or more than one winding is not convex,
+	 * nor is a sliver whose vertex average does not land strictly inside it.
+	 *
+	 * @param[out] outConvexity Descriptor for isInsidePolygonConvex / doesLineIntersectPolygonConvex.
+	 * @param[out] resultState  EResultState.
+	 */
+	API_FUNCTIONS void InitPolygonConvexity(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		SPolygonConvexity* outConvexity,
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief isInsidePolygon in O(log n) for a convex polygon.
+	 *
+	 * The center is located by binary search over a triangle fan around the polygon; a center
+	 * outside the polygon walks from the edge it faces to the nearest edge for the radius test. Results
+	 * equal isInsidePolygon except for centers within float rounding of the boundary.
+	 * A polygon that is not convex is answered by isInsidePolygon.
+	 *
+	 * @param[in] convexity Descriptor filled by InitPolygonConvexity for this polygon.
+	 */
+	API_FUNCTIONS void isInsidePolygonConvex(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SPolygonConvexity* convexity,
+		const SPointNE testPoint,
+		float radiusMeters,
+		uint8_t* outResult,	 // bool
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief doesLineIntersectPolygon for a convex polygon, as a Cyrus-Beck clip.
+	 *
+	 * A start point inside or on the boundary hits (the O(log n) isInsidePolygonConvex test);
+	 * otherwise the segment is clipped against each edge half-plane and hits when something is
+	 * left. Touching contacts count within the orientation() tolerance, as in doesLineIntersectPolygon.
+	 * A polygon that is not convex is answered by doesLineIntersectPolygon.
+	 *
+	 * @param[in] convexity Descriptor filled by InitPolygonConvexity for this polygon.
+	 */
+	API_FUNCTIONS void doesLineIntersectPolygonConvex(
+		const SPointNE* polygon,
+		uint16_t pointCount,
+		const SPolygonConvexity* convexity,
+		const SPointNE testPoint,
+		float azimuthDegrees,
+		float maxLength,
+		uint8_t* outResult,	 // bool
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief isInsidePolygon for a zone made of several rings (an outer boundary plus holes).
+	 *
+	 * All rings are stored back to back in one array; ring r is points[ringOffsets[r]] up to
+	 * points[ringOffsets[r + 1] - 1], closing on its first point. The center is inside when an odd
+	 * number of rings surround it (even-odd rule), so the winding of each ring does not matter.
+	 * A circle touching any ring, hole edges included, collides. The rings share one parity pass
+	 * and one radius pass instead of a call per ring.
+	 * With a single ring the result equals isInsidePolygon.
+	 *
+	 * @param[in] points       Vertices of all rings (ringOffsets[ringCount] points).
+	 * @param[in] ringOffsets  ringCount + 1 offsets into points, each ring holding at least 3 points.
+	 * @param[in] ringCount    Number of rings.
+	 * @param[out] resultState EResultState: POLYGON_IS_NULL_PTR, BUFFER_IS_NULL_PTR for null offsets,
+	 *                         POLYGON_WITH_LESS_THAN_3_POINTS for no ring or a ring below 3 points.
+	 */
+	API_FUNCTIONS void isInsideMultiPolygon(
+		const SPointNE* points,
+		const uint32_t* ringOffsets, // uint32_t[ringCount + 1]
+		uint32_t ringCount,
+		const SPointNE testPoint,
+		float radiusMeters,
+		uint8_t* outResult,	 // bool
+		uint8_t* resultState // EResultState
+	);
+
+	/**
+	 * @brief doesLineIntersectPolygon for a zone made of several rings, in one call.
+	 *
+	 * Hits when the start point is inside the zone (even-odd over all rings) or the segment
+	 * touches any ring. A segment starting in a hole and staying in it does not hit.
+	 * Rings are laid out as in isInsideMultiPolygon.
+	 */
+	API_FUNCTIONS void doesLineIntersectMultiPolygon(
+		const SPointNE* points,
+		const uint32_t* ringOffsets, // uint32_t[ringCount + 1]
+		uint32_t ringCount,
+		const SPointNE testPoint,
+		float azimuthDegrees,
+		float maxLength,
+		uint8_t* outResult,	 // bool
+		uint8_t* resultState // EResultState
+	);
+}
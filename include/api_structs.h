@@ -21,6 +21,37 @@ struct SPointNED {
 	double down; // m
 };
 
+/**
+ * @struct SLocalFrame
+ * @brief Precomputed local NED frame around a fixed origin.
+ *
+ * Caller-owned and filled once by InitLocalFrame; converting a point against the frame
+ * costs a subtraction and a 3x3 multiply instead of rebuilding the origin every call.
+ */
+struct SLocalFrame {
+	SPointECEF originEcef;  /**< Origin position in ECEF (m). */
+	double ecefToNed[3][3]; /**< Rotation from ECEF to NED. */
+	double nedToEcef[3][3]; /**< Rotation from NED to ECEF (transpose of ecefToNed). */
+};
+
+/**
+ * @struct SLocalSeriesFrame
+ * @brief Coefficients of the second-order GeoToNed / NedToGeo series around a fixed origin.
+ *
+ * Caller-owned and filled once by InitLocalSeriesFrame (see GeoToNedSeriesBatch).
+ */
+struct SLocalSeriesFrame {
+	double originLatitudeRad;  /**< Origin latitude (rad). */
+	double originLongitudeRad; /**< Origin longitude (rad). */
+	double originAltitude;     /**< Origin altitude (m). */
+	double sinLat;             /**< sin of the origin latitude. */
+	double cosLat;             /**< cos of the origin latitude. */
+	double meridianRadius;     /**< M + h0: meters north per radian of latitude (m). */
+	double normalRadius;       /**< N + h0: prime vertical radius at the origin altitude (m). */
+	double meridianSlope;      /**< Half the latitude derivative of M (m). */
+	double boundScale;         /**< 0.5 * (1 + tan^2(lat0)) / A^2, for the error bound (1/m^2). */
+};
+
 /**
  * @struct SPointNE
  * @brief Represents a point in a Local Tangent Plane (NED) coordinate system.
@@ -33,6 +64,123 @@ struct SPointNE {
 	float east;  /**< Distance in meters along the East axis (Y). */
 };
 
+/**
+ * @struct SRayNE
+ * @brief A ray from startPoint along azimuthDegrees (0 = North, 90 = East), limited to maxLength meters.
+ */
+struct SRayNE {
+	SPointNE startPoint;  /**< Ray origin. */
+	float azimuthDegrees; /**< Direction in degrees, clockwise from North. */
+	float maxLength;      /**< Ray length in meters (must be positive). */
+};
+
+/**
+ * @struct SRayHit
+ * @brief First boundary contact of a ray with a polygon.
+ *
+ * edgeIndex k is the edge from vertex k to vertex k + 1; it is 0xFFFF when the
+ * ray starts inside the polygon (distance 0) or misses it.
+ */
+struct SRayHit {
+	uint8_t isHit;      /**< Same answer as doesLineIntersectPolygon for the ray. */
+	uint16_t edgeIndex; /**< Edge of the first contact, or 0xFFFF (inside start / no hit). */
+	float distance;     /**< Meters from startPoint to the contact (0 when no hit). */
+	SPointNE hitPoint;  /**< Contact point (startPoint when no hit). */
+};
+
+/**
+ * @struct SPolygonClearance
+ * @brief Circle-vs-polygon result with the distance margin to the boundary.
+ *
+ * nearestEdge k is the edge from vertex k to vertex k + 1 closest to the center.
+ */
+struct SPolygonClearance {
+	uint8_t isCollision;    /**< Same answer as isInsidePolygon. */
+	uint16_t nearestEdge;   /**< Edge closest to the center. */
+	float signedDistance;   /**< Center to boundary in meters, negative inside the polygon. */
+	float clearance;        /**< signedDistance - |radius|; the free margin, negative once the circle crosses in. */
+};
+
+/**
+ * @struct SRouteViolation
+ * @brief First place where a route of waypoints enters or touches a polygon.
+ *
+ * Leg k runs from waypoint k to waypoint k + 1; legParam is the fraction of that leg
+ * (0 = waypoint k, 1 = waypoint k + 1) at the first contact.
+ */
+struct SRouteViolation {
+	uint8_t isViolation; /**< True if the route starts inside or any leg touches an edge. */
+	uint32_t legIndex;   /**< First violating leg, or 0xFFFFFFFF when there is none. */
+	uint16_t edgeIndex;  /**< Polygon edge of the contact, or 0xFFFF when the route starts inside / is clear. */
+	float legParam;      /**< Contact parameter along the leg, in [0, 1]. */
+	SPointNE hitPoint;   /**< Contact point (first waypoint when the route starts inside). */
+};
+
+/**
+ * @struct SPolygonBounds
+ * @brief Axis-aligned bounding box and bounding circle of a polygon, filled once by InitPolygonBounds.
+ *
+ * Caller-owned; lets the *Bounded queries answer "false" in O(1) for queries far from the polygon.
+ */
+struct SPolygonBounds {
+	uint16_t pointCount; /**< Vertex count of the polygon the bounds describe. */
+	float minNorth;      /**< Bounding box (m). */
+	float minEast;
+	float maxNorth;
+	float maxEast;
+	SPointNE center;     /**< Bounding circle center (box center). */
+	float radius;        /**< Bounding circle radius (m), rounded up. */
+	float maxAbsCoord;   /**< Largest absolute vertex coordinate (for the query tolerance). */
+};
+
+/**
+ * @struct SArena
+ * @brief Scratch arena over caller memory, set up by ArenaInit.
+ *
+ * Caller-owned; ArenaAlloc bumps used, ArenaRewind moves it back to a mark, and
+ * highWater keeps the largest used value seen since ArenaInit.
+ */
+struct SArena {
+	uint8_t* base;      /**< Start of the caller buffer. */
+	uint32_t capacity;  /**< Buffer size in bytes. */
+	uint32_t used;      /**< Bytes in use, alignment padding included. */
+	uint32_t highWater; /**< Peak of used (bytes). */
+};
+
+/**
+ * @struct SPolygonTracker
+ * @brief Caller-owned state of isInsidePolygonTracked for one moving point and one polygon.
+ *
+ * Holds the result of the last full evaluation (the anchor). While the point stays well within
+ * the anchor's distance to the boundary, the answer cannot change and is given in O(1).
+ */
+struct SPolygonTracker {
+	uint16_t pointCount;    /**< Vertex count of the tracked polygon. */
+	uint8_t hasAnchor;      /**< False until the first full evaluation. */
+	uint8_t isAnchorInside; /**< Inside/outside status of the anchor center. */
+	uint16_t nearestEdge;   /**< Edge closest to the anchor. */
+	SPointNE anchor;        /**< Position of the last full evaluation. */
+	float anchorDistance;   /**< Anchor to boundary distance (m). */
+	float maxAbsCoord;      /**< Largest absolute vertex coordinate (for the rounding margin). */
+	uint8_t lastResult;     /**< Answer of the last query. */
+	float lastClearance;    /**< Clearance of the last query (m); exact after a full evaluation, otherwise a
+	                             bound that never overstates the distance to the boundary. */
+};
+
+/**
+ * @struct SPolygonConvexity
+ * @brief Convexity of a polygon, filled once by InitPolygonConvexity.
+ *
+ * Caller-owned; when isConvex is set, the *Convex queries answer in O(log n) instead of
+ * visiting every edge.
+ */
+struct SPolygonConvexity {
+	uint16_t pointCount; /**< Vertex count of the polygon the descriptor describes. */
+	uint8_t isConvex;    /**< True when the polygon is strictly convex with a single winding. */
+	int8_t windingSign;  /**< +1 or -1: sign of the turn at every vertex (0 when not convex). */
+	SPointNE center;     /**< Vertex average, strictly inside a convex polygon. */
+};
+
 /**
  * @enum ResultState
  * @brief determines the status of the result
@@ -42,7 +190,47 @@ enum EResultState : uint8_t
 	OK = 0,
 	POLYGON_WITH_LESS_THAN_3_POINTS = 1,
 	POLYGON_IS_NULL_PTR = 2,
-	MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO = 3
+	MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO = 3,
+	POINTS_IS_NULL_PTR = 4,
+	KERNEL_NOT_SUPPORTED = 5,
+	BUFFER_IS_NULL_PTR = 6,
+	BUFFER_TOO_SMALL = 7,
+	BUFFER_NOT_ALIGNED = 8,
+	PREPARED_DATA_INVALID = 9,
+	INDEX_TOO_LARGE = 10,
+	OUTPUT_TOO_SMALL = 11,
+	METHOD_NOT_SUPPORTED = 12,
+	ARENA_MARK_INVALID = 13,
+	THREAD_COUNT_INVALID = 14,
+	THREAD_START_FAILED = 15,
+	ROUTE_WITH_LESS_THAN_2_POINTS = 16,
+	STRIDE_TOO_SMALL = 17,
+	POOL_ALREADY_STARTED = 18
+};
+
+/**
+ * @enum ECoordsKernel
+ * @brief Selects the implementation used by the array GeoToEcef / EcefToGeo conversions.
+ */
+enum ECoordsKernel : uint8_t
+{
+	KERNEL_AUTO = 0,      // fastest kernel supported by the CPU (CPUID dispatch)
+	KERNEL_REFERENCE = 1, // per-point GeoToEcef / EcefToGeo (libm)
+	KERNEL_SCALAR = 2,    // polynomial kernel, one point at a time
+	KERNEL_AVX2 = 3,      // polynomial kernel, 4 points per iteration
+	KERNEL_AVX512 = 4     // polynomial kernel, 8 points per iteration
+};
+
+/**
+ * @enum EEcefToGeoMethod
+ * @brief Selects the ECEF -> geodetic algorithm. Accuracy is measured over -1 km .. +100 km
+ * altitude against round trips from exact geodetic points (see coords_conv_functions.h).
+ */
+enum EEcefToGeoMethod : uint8_t
+{
+	ECEF_TO_GEO_BOWRING = 0,   // EcefToGeo: Bowring with one refinement (default)
+	ECEF_TO_GEO_VERMEILLE = 1, // Vermeille closed form (cube root, no trig in the latitude)
+	ECEF_TO_GEO_OLSON = 2      // Olson series with one Newton step
 };
 
 #pragma pack(pop)
\ No newline at end of file
@@ -10,21 +10,75 @@
 const double PI = 3.14159265358979323846;
 const double EPSILON_COORDS = 1e-9;
 
-namespace WGS84
+// --- Ellipsoids ---
+
+// Square root usable in constant expressions (Newton iterations, for constants near 1)
+constexpr double ConstexprSqrt(double x)
 {
-	constexpr double F = 3.352810664747481e-003;													// Flattening
-	constexpr double A = 6.378137e6;																// Semi-major axis (meters)
-	constexpr double E2 = 2.0 * F - F * F;															// Eccentricity squared
-	inline double W2(double latitude) { return 1 - E2 * std::sin(latitude) * std::sin(latitude); }  // RT_OMEGA_WGS^2
-	inline double W(double latitude) { return std::sqrt(W2(latitude)); }							// RT_OMEGA_WGS
-	inline double RN(double latitude) { return A / W(latitude); }									// Normal (east/west) prime vertical curvature radii (m)
+	double root = (x > 1.0) ? x : 1.0;
+	for (int i = 0; i < 64; ++i) {
+		root = 0.5 * (root + x / root);
+	}
+	return root;
 }
 
+// Defining constants of the reference ellipsoids; the conversion core is templated on these.
+struct SWgs84Ellipsoid
+{
+	static constexpr double A = 6.378137e6;				// Semi-major axis (meters)
+	static constexpr double F = 3.352810664747481e-003;	// Flattening
+};
+
+struct SGrs80Ellipsoid
+{
+	static constexpr double A = 6.378137e6;
+	static constexpr double F = 1.0 / 298.257222101;
+};
+
+/**
+ * Everything the conversions derive from an ellipsoid, folded at compile time, plus the
+ * curvature radii. W2 / W / RN / RM take the latitude (rad); the *FromSinLat forms take
+ * sin(latitude) so callers that already hold it (from a fused sincos) never evaluate it twice.
+ */
+template <typename TEllipsoid>
+struct SEllipsoidConstants
+{
+	static constexpr double A = TEllipsoid::A;
+	static constexpr double F = TEllipsoid::F;
+	static constexpr double E2 = 2.0 * TEllipsoid::F - TEllipsoid::F * TEllipsoid::F;	// Eccentricity squared
+	static constexpr double ONE_MINUS_E2 = 1.0 - E2;
+	static constexpr double SQRT_ONE_MINUS_E2 = ConstexprSqrt(ONE_MINUS_E2);
+	static constexpr double E2_A = E2 * A;
+	static constexpr double EP2_B = E2 / ONE_MINUS_E2 * A * SQRT_ONE_MINUS_E2;	// e'^2 * semi-minor axis (Bowring)
+
+	static inline double W2FromSinLat(double sinLat) { return 1.0 - E2 * sinLat * sinLat; }
+	static inline double RNFromSinLat(double sinLat) { return A / std::sqrt(W2FromSinLat(sinLat)); }
+	static inline double RMFromSinLat(double sinLat) { const double w2 = W2FromSinLat(sinLat); return A * ONE_MINUS_E2 / (w2 * std::sqrt(w2)); }
+
+	static inline double W2(double latitude) { return 1 - E2 * std::sin(latitude) * std::sin(latitude); }	// RT_OMEGA^2
+	static inline double W(double latitude) { return std::sqrt(W2(latitude)); }							// RT_OMEGA
+	static inline double RN(double latitude) { return A / W(latitude); }									// Normal (east/west) prime vertical curvature radius (m)
+	static inline double RM(double latitude) { return A * (1 - E2) / (W2(latitude) * W(latitude)); }		// Meridian (north/south) curvature radius (m)
+};
+
+typedef SEllipsoidConstants<SWgs84Ellipsoid> WGS84;
+
 namespace EARTH_CONSTS
 {
 	constexpr double R0 = 6378137.0; // Nominal radius of earth (m)
 }
 
+// sin and cos of one angle in a single libm call where the compiler provides it
+inline void SinCos(double angle, double& sinValue, double& cosValue)
+{
+#if defined(__GNUC__) && !defined(__clang__)
+	__builtin_sincos(angle, &sinValue, &cosValue);
+#else
+	sinValue = std::sin(angle);
+	cosValue = std::cos(angle);
+#endif
+}
+
 namespace API_UTILS
 {
 	inline double safe_sqrt(double x, double default_value = 0.0) { return (x >= 0.0) ? std::sqrt(x) : default_value; }
@@ -39,12 +93,97 @@ double NavValidateLongitude(const double& inLongitude);
 
 void MulMatVec3(const double A[3][3], const double VIn[3], double VOut[3]);
 
+// Origin-dependent part of EcefToNed / NedToEcef (rotation matrices and origin in ECEF), WGS84.
+// Compute once and reuse when converting many points around the same origin.
+SLocalFrame ComputeLocalFrame(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude);
+
+// Series coefficients of GeoToNedSeries / NedToGeoSeries around the origin.
+SLocalSeriesFrame ComputeLocalSeriesFrame(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude);
+
+/**
+ * Second-order local tangent plane series (small-area mode).
+ *
+ * With a = dLat, b = dLon (rad), c = dAlt (m), s0 / c0 = sin / cos of the origin latitude and
+ * the radii M, N taken at the origin altitude h0:
+ *
+ *   north = (M + h0) a + 1/2 dM/dlat a^2 + a c + 1/2 (N + h0) s0 c0 b^2
+ *   east  = (N + h0) c0 b - (M + h0) s0 a b + c0 b c
+ *   down  = -c + 1/2 (M + h0) a^2 + 1/2 (N + h0) c0^2 b^2
+ *
+ * The inverse solves the same series by fixed-point iteration. Both report the worst-case
+ * distance to the exact conversion for the point (GetSeriesErrorBound):
+ *
+ *   bound = 0.5 * (rho^3 (1 + tan^2 lat0) + rho^2 |dAlt| + rho dAlt^2) / A^2 + 1e-6 m
+ *
+ * where rho is the horizontal distance from the origin. Measured errors stay under half of the
+ * polynomial term everywhere, poles included (0.49 at worst in the tests, about 1/3 at the equator);
+ * the 1 um floor covers the rounding of the exact path. At the equator with dAlt = 0 the bound is
+ * 1.3e-5 m at 1 km, 0.098 m at 20 km and 12.3 m at 100 km, for measured errors of 4e-6 m, 0.032 m
+ * and 4.0 m against GeoToNed: the series is for cm-level budgets at tens of km, not mm-level.
+ * Beyond |dLat| or |dLon| of SERIES_MAX_ANGLE_RAD the series is not used and the bound is infinite.
+ */
+const double SERIES_MAX_ANGLE_RAD = 0.1;
+
+double GetSeriesErrorBound(const SLocalSeriesFrame& frame, const double horizontalDistance, const double altitudeDelta);
+
+SPointNED GeoToNedSeries(const SLocalSeriesFrame& frame, const SPointGeo& geoPoint, double* outErrorBound);
+
+SPointGeo NedToGeoSeries(const SLocalSeriesFrame& frame, const SPointNED& nedPoint, double* outErrorBound);
+
 // --- main functions ---
 
+// Conversion core, explicitly instantiated for SWgs84Ellipsoid and SGrs80Ellipsoid in
+// coords_conv_functions.cpp. The untemplated overloads below are the WGS84 instantiations.
+
+template <typename TEllipsoid>
+SLocalFrame ComputeLocalFrame(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude);
+
+template <typename TEllipsoid>
 SPointECEF GeoToEcef(const SPointGeo geoPoint);
 
+template <typename TEllipsoid>
 SPointGeo EcefToGeo(const SPointECEF ecefPoint);
 
+template <typename TEllipsoid>
+SPointGeo EcefToGeoVermeille(const SPointECEF ecefPoint);
+
+template <typename TEllipsoid>
+SPointGeo EcefToGeoOlson(const SPointECEF ecefPoint);
+
+template <typename TEllipsoid>
 SPointNED EcefToNed(const double originLatitudeDeg, const double originLongitudeDeg, const double altitude, const SPointECEF ecefPoint);
 
+template <typename TEllipsoid>
 SPointECEF NedToEcef(const double originLatitudeDeg, const double originLongitudeDeg, const double altitude, const SPointNED nedPoint);
+
+// --- WGS84 wrappers ---
+
+SPointECEF GeoToEcef(const SPointGeo geoPoint);
+
+/**
+ * ECEF -> geodetic algorithms (EEcefToGeoMethod).
+ *
+ * Max error of GeoToEcef -> EcefToGeo round trips on a global grid, altitude -1 km .. +100 km:
+ *
+ *   Bowring (EcefToGeo)   |h| <= 1 km: 1e-13 deg, 1.1e-8 m    10 km: 8e-12 deg, 9e-7 m
+ *                         100 km: 8e-10 deg, 9e-5 m           exactly on a pole: up to 9e-6 deg
+ *   Vermeille             3e-14 deg, 5e-9 m over the whole range, poles included
+ *   Olson                 3e-14 deg, 5e-9 m over the whole range, poles included
+ */
+SPointGeo EcefToGeo(const SPointECEF ecefPoint);
+
+SPointGeo EcefToGeoVermeille(const SPointECEF ecefPoint);
+
+SPointGeo EcefToGeoOlson(const SPointECEF ecefPoint);
+
+SPointGeo EcefToGeo(const SPointECEF ecefPoint, EEcefToGeoMethod method);
+
+SPointNED EcefToNed(const double originLatitudeDeg, const double originLongitudeDeg, const double altitude, const SPointECEF ecefPoint);
+
+SPointECEF NedToEcef(const double originLatitudeDeg, const double originLongitudeDeg, const double altitude, const SPointNED nedPoint);
+
+// --- Frame-based conversions (the ellipsoid is already in the frame's origin) ---
+
+SPointNED EcefToNed(const SLocalFrame& frame, const SPointECEF ecefPoint);
+
+SPointECEF NedToEcef(const SLocalFrame& frame, const SPointNED nedPoint);
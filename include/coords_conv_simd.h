@@ -0,0 +1,36 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+
+// --- Array kernels for GeoToEcef / EcefToGeo ---
+// Every kernel writes pointCount results; inputs and outputs are tightly packed arrays.
+// See coords_conv_kernels.h for the accuracy of the polynomial kernels.
+
+void GeoToEcefReference(const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints);
+void EcefToGeoReference(const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints);
+
+void GeoToEcefScalar(const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints);
+void EcefToGeoScalar(const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints);
+
+#if defined(API_FUNCTIONS_X86_KERNELS)
+void GeoToEcefAvx2(const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints);
+void EcefToGeoAvx2(const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints);
+
+void GeoToEcefAvx512(const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints);
+void EcefToGeoAvx512(const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints);
+#endif
+
+// --- Runtime dispatch ---
+
+// True if the kernel is compiled in and the CPU/OS support it. KERNEL_AUTO is always supported.
+bool IsCoordsKernelSupported(ECoordsKernel kernel);
+
+// Fastest supported kernel, detected once with CPUID.
+ECoordsKernel GetBestCoordsKernel();
+
+// Runs the requested kernel (KERNEL_AUTO resolves to GetBestCoordsKernel()).
+// The caller must check IsCoordsKernelSupported first.
+void GeoToEcefDispatch(ECoordsKernel kernel, const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints);
+void EcefToGeoDispatch(ECoordsKernel kernel, const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints);
@@ -1,28 +1,141 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#else
+    #include <chrono>
+#endif
+
 /**
- * Internal instrumentation for manual code coverage tracking.
+ * Internal instrumentation: hit counters at code-path sites and per-function timers.
  *
- * This file defines macros used to verify that specific code paths are executed
- * during testing. This is a lightweight alternative to external coverage tools,
- * designed for specific logic verification.
+ * COV_POINT, REJECT_COUNT and PREDICATE_COUNT sites each own a 64-bit counter, incremented with a relaxed
+ * atomic add, so counts are exact when several threads call the API at once. API_TIMER
+ * adds the call count and elapsed cycles (inclusive of nested API calls) of a function;
+ * timers only run after EnableApiTimers(true), since reading the cycle counter costs far
+ * more than a counter increment.
  *
- * @note These macros are active ONLY in _DEBUG builds. In Release builds,
- * they resolve to no-ops (void)0 to ensure zero performance impact.
+ * @note Active in _DEBUG builds, and in release builds configured with
+ * API_FUNCTIONS_INSTRUMENTATION=ON. Otherwise every macro resolves to (void)0.
  */
 
+#if defined(_DEBUG) || !defined(NDEBUG) || defined(API_FUNCTIONS_INSTRUMENTATION)
+    #define API_FUNCTIONS_INSTRUMENTED
+#endif
+
 enum ECovFuncID {
     IsInside = 0,
     Intersect = 1,
     MAX_FUNCS
 };
 
-#define MAX_POINTS_PER_FUNC 20 
+#define MAX_POINTS_PER_FUNC 20
+
+/**
+ * Early-reject counters of the bounds-aware queries (isInsidePolygonBounded,
+ * doesLineIntersectPolygonBounded) and of isInsidePolygonTracked.
+ */
+enum ERejectCounterID {
+    InsideQueries = 0,
+    InsideBoxRejects = 1,
+    InsideCircleRejects = 2,
+    IntersectQueries = 3,
+    IntersectBoxRejects = 4,
+    IntersectCircleRejects = 5,
+    TrackerQueries = 6,
+    TrackerReuses = 7,
+    MAX_REJECT_COUNTERS
+};
+
+// Calls and slow-path evaluations of the exact geometric predicates (robust_predicates.h)
+enum EPredicateCounterID {
+    OrientQueries = 0,
+    OrientExactFallbacks = 1,
+    MAX_PREDICATE_COUNTERS
+};
+
+// Timed API functions
+enum EApiTimerID {
+    TimerIsInsidePolygon = 0,
+    TimerDoesLineIntersectPolygon,
+    TimerIsInsidePolygonPrepared,
+    TimerIsInsidePolygonBatch,
+    TimerIsInsidePolygonBounded,
+    TimerDoesLineIntersectPolygonBounded,
+    TimerIsInsidePolygonTracked,
+    TimerGetPolygonClearance,
+    TimerGetFirstRayHit,
+    TimerQueryZonesCircle,
+    TimerQueryZonesSegment,
+    TimerDoesRouteIntersectPolygon,
+    TimerGeoToNed,
+    TimerNedToGeo,
+    TimerGeoToNedBatch,
+    TimerNedToGeoBatch,
+    TimerImportGeoPolygon,
+    MAX_API_TIMERS
+};
+
+/**
+ * @struct SInstrumentationSnapshot
+ * @brief Copy of every counter, filled by SnapshotInstrumentation.
+ */
+struct SInstrumentationSnapshot {
+    uint64_t covPoints[(int)ECovFuncID::MAX_FUNCS][MAX_POINTS_PER_FUNC]; /**< Hits per COV_POINT site. */
+    uint64_t rejectCounters[(int)ERejectCounterID::MAX_REJECT_COUNTERS];  /**< REJECT_COUNT totals. */
+    uint64_t predicateCounters[(int)EPredicateCounterID::MAX_PREDICATE_COUNTERS]; /**< PREDICATE_COUNT totals. */
+    uint64_t timerCalls[(int)EApiTimerID::MAX_API_TIMERS];                /**< Timed calls per function. */
+    uint64_t timerCycles[(int)EApiTimerID::MAX_API_TIMERS];               /**< Cycles (TSC, or ns without one) per function. */
+};
+
+#if defined(API_FUNCTIONS_INSTRUMENTED)
+    extern std::atomic<uint64_t> g_cov_counters[(int)ECovFuncID::MAX_FUNCS][MAX_POINTS_PER_FUNC];
+    extern std::atomic<uint64_t> g_reject_counters[(int)ERejectCounterID::MAX_REJECT_COUNTERS];
+    extern std::atomic<uint64_t> g_predicate_counters[(int)EPredicateCounterID::MAX_PREDICATE_COUNTERS];
+    extern std::atomic<uint64_t> g_timer_calls[(int)EApiTimerID::MAX_API_TIMERS];
+    extern std::atomic<uint64_t> g_timer_cycles[(int)EApiTimerID::MAX_API_TIMERS];
+    extern std::atomic<bool> g_timers_enabled;
+
+    inline uint64_t ReadCycleCounter() {
+    #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        return __rdtsc();
+    #elif defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+    #else
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    #endif
+    }
+
+    // Adds the cycles between construction and destruction to one timer
+    class CApiTimerScope {
+    public:
+        explicit CApiTimerScope(EApiTimerID id)
+            : m_id(id), m_start(g_timers_enabled.load(std::memory_order_relaxed) ? ReadCycleCounter() : 0) {}
+
+        ~CApiTimerScope() {
+            if (m_start != 0) {
+                g_timer_cycles[(int)m_id].fetch_add(ReadCycleCounter() - m_start, std::memory_order_relaxed);
+                g_timer_calls[(int)m_id].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        EApiTimerID m_id;
+        uint64_t m_start;
+    };
 
-#if defined(_DEBUG) || !defined(NDEBUG)
-    extern bool g_cov_map[(int)ECovFuncID::MAX_FUNCS][MAX_POINTS_PER_FUNC];
-    #define COV_POINT(id) g_cov_map[(int)current_func_id][id] = true
+    #define COV_POINT(id) g_cov_counters[(int)current_func_id][id].fetch_add(1, std::memory_order_relaxed)
+    #define REJECT_COUNT(id) g_reject_counters[(int)(id)].fetch_add(1, std::memory_order_relaxed)
+    #define PREDICATE_COUNT(id) g_predicate_counters[(int)(id)].fetch_add(1, std::memory_order_relaxed)
+    #define API_TIMER(id) CApiTimerScope api_timer_scope(id)
 #else
     #define COV_POINT(id) ((void)0)
-#endif
\ No newline at end of file
+    #define REJECT_COUNT(id) ((void)0)
+    #define PREDICATE_COUNT(id) ((void)0)
+    #define API_TIMER(id) ((void)0)
+#endif
@@ -3,9 +3,10 @@
 #include "api_structs.h"
 
 #include <cmath>     // for fabs,sin,cos
+#include <cfloat>    // for FLT_EPSILON
 
 // --- Constants ---
-const double EPSILON = 1e-9;
+constexpr double EPSILON = 1e-9;
 
 // --- Helper Functions ---
 #define MIN(a, b) (((a) < (b)) ? (a) : (b))
@@ -13,6 +14,54 @@ const double EPSILON = 1e-9;
 
 bool areAlmostEqual(const float a, const float b);
 
+// --- Precision policies ---
+// Every intermediate of the templated kernels below is computed in TPrecision::Real. An orientation
+// determinant a*b - c*d counts as zero within TOLERANCE + RELATIVE_TOLERANCE * (|a*b| + |c*d|).
+
+// All-float fast path. The fixed tolerance is below float resolution once the products exceed ~1,
+// so the band scales with them: a few ulps, just over the rounding of the float determinant.
+struct SFloatPrecision {
+	typedef float Real;
+	static constexpr float TOLERANCE = (float)(EPSILON * 100.0);
+	static constexpr float RELATIVE_TOLERANCE = 4.0f * FLT_EPSILON;
+};
+
+// All-double accurate path (used by the API functions)
+struct SDoublePrecision {
+	typedef double Real;
+	static constexpr double TOLERANCE = EPSILON * 100.0;
+	static constexpr double RELATIVE_TOLERANCE = 0.0;
+};
+
+// Double path without the tolerance: orientation() takes the exact sign of robust_predicates.h,
+// so only exactly collinear points count as collinear, at any coordinate scale
+struct SRobustPrecision {
+	typedef double Real;
+	static constexpr double TOLERANCE = 0.0;
+	static constexpr double RELATIVE_TOLERANCE = 0.0;
+};
+
+// Instantiated for SFloatPrecision, SDoublePrecision and SRobustPrecision in geometric_functions.cpp
+template <typename TPrecision>
+typename TPrecision::Real getDistSq(const SPointNE& a, const SPointNE& b);
+
+template <typename TPrecision>
+typename TPrecision::Real getDistToSegmentSquared(const SPointNE& p, const SPointNE& a, const SPointNE& b);
+
+template <typename TPrecision>
+bool onSegment(const SPointNE& p, const SPointNE& q, const SPointNE& r);
+
+template <typename TPrecision>
+int orientation(const SPointNE& p, const SPointNE& q, const SPointNE& r);
+
+template <>
+int orientation<SRobustPrecision>(const SPointNE& p, const SPointNE& q, const SPointNE& r);
+
+template <typename TPrecision>
+bool doSegmentsIntersect(const SPointNE& p1, const SPointNE& q1, const SPointNE& p2, const SPointNE& q2);
+
+// --- Double path wrappers ---
+
 double getDistSq(const SPointNE& a, const SPointNE& b);
 
 double getDistToSegmentSquared(const SPointNE& p, const SPointNE& a, const SPointNE& b);
@@ -21,4 +70,23 @@ bool onSegment(const SPointNE& p, const SPointNE& q, const SPointNE& r);
 
 int orientation(const SPointNE& p, const SPointNE& q, const SPointNE& r);
 
-bool doSegmentsIntersect(const SPointNE& p1, const SPointNE& q1, const SPointNE& p2, const SPointNE& q2);
\ No newline at end of file
+bool doSegmentsIntersect(const SPointNE& p1, const SPointNE& q1, const SPointNE& p2, const SPointNE& q2);
+
+double getFirstContactParam(const SPointNE& p1, const SPointNE& q1, const SPointNE& p2, const SPointNE& q2);
+
+// --- isInsidePolygon edge tests (shared by every containment path so results stay identical) ---
+
+bool doesEdgeStraddleEast(const SPointNE& a, const SPointNE& b, const SPointNE& p);
+
+bool doesRayCrossEdgeNorth(const SPointNE& a, const SPointNE& b, const SPointNE& p);
+
+bool isWithinRadius(const double distSq, const float radiusMeters);
+
+bool isOnBoundary(const double distSq);
+
+// Padding for the search boxes and rejection tests of the indices, bounds, zone index and tracker.
+// 1 mm plus 1e-5 of the largest coordinate involved is well beyond the float rounding of the edge
+// tests above, so a padded box never skips an edge the exact test could flag.
+inline double getSearchMargin(const float maxAbsCoord) {
+	return 1e-3 + 1e-5 * maxAbsCoord;
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+
+// Test points evaluated together by one pass over the polygon edges
+const uint32_t POLYGON_BATCH_BLOCK = 64;
+
+/**
+ * Edge-major isInsidePolygon for up to POLYGON_BATCH_BLOCK test points.
+ *
+ * Each edge is loaded once and tested against the whole block, first for the ray-cast
+ * parity and then for the circle distance of the points still undecided. Results are
+ * identical to calling isInsidePolygon per point. The polygon must already be validated.
+ *
+ * @param radii     Per-point radii, or nullptr to use radiusMeters for every point.
+ * @return Bit i set if test point i collides.
+ */
+uint64_t IsInsidePolygonBlock(const SPointNE* polygon, uint16_t pointCount, const SPointNE* testPoints, uint32_t testCount, const float* radii, float radiusMeters);
+
+// Validates and runs a whole batch; setBit(i, value) receives every result.
+template <typename TWriter>
+EResultState IsInsidePolygonBatchRun(const SPointNE* polygon, uint16_t pointCount, const SPointNE* testPoints, uint32_t testCount, const float* radii, float radiusMeters, TWriter setBits)
+{
+	if (polygon == nullptr) return EResultState::POLYGON_IS_NULL_PTR;
+	if (pointCount < 3) return EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+	if (testPoints == nullptr) return EResultState::POINTS_IS_NULL_PTR;
+
+	for (uint32_t base = 0; base < testCount; base += POLYGON_BATCH_BLOCK) {
+		const uint32_t blockCount = (testCount - base < POLYGON_BATCH_BLOCK) ? (testCount - base) : POLYGON_BATCH_BLOCK;
+		const uint64_t mask = IsInsidePolygonBlock(polygon, pointCount, testPoints + base, blockCount,
+			(radii != nullptr) ? radii + base : nullptr, radiusMeters);
+		setBits(base, blockCount, mask);
+	}
+	return EResultState::OK;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+
+// Which test of the bounds descriptor rejected a query
+enum EBoundsReject {
+	REJECT_NONE = 0,
+	REJECT_BY_BOX = 1,
+	REJECT_BY_CIRCLE = 2
+};
+
+// Bounding box, and bounding circle around the box center, of a validated polygon.
+SPolygonBounds ComputePolygonBounds(const SPointNE* polygon, uint16_t pointCount);
+
+// REJECT_BY_* when the circle cannot touch the polygon, so isInsidePolygon would be false.
+// Non-finite inputs are never rejected.
+EBoundsReject CheckCircleAgainstBounds(const SPolygonBounds& bounds, const SPointNE& testPoint, float radiusMeters);
+
+// REJECT_BY_* when segment start-end stays clear of the polygon.
+EBoundsReject CheckSegmentAgainstBounds(const SPolygonBounds& bounds, const SPointNE& startPoint, const SPointNE& endPoint);
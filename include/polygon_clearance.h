@@ -0,0 +1,14 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+
+/**
+ * Single pass over the edges of a validated polygon, accumulating the ray-cast parity of
+ * the center and the minimum squared distance to the boundary together.
+ *
+ * The radius test of isInsidePolygon is monotone in the distance, so testing it once on the
+ * minimum gives the same isCollision as testing every edge.
+ */
+SPolygonClearance ComputePolygonClearance(const SPointNE* polygon, uint16_t pointCount, const SPointNE& testPoint, float radiusMeters);
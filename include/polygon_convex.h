@@ -0,0 +1,33 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+
+// Convexity descriptor of a validated polygon (isConvex false sends every query to the general path).
+// Convex here means: no zero-length edge, every turn in the same direction (straight vertices
+// allowed, reversals not), a single winding, checked by counting how often the edge directions
+// change sign along each axis (at most twice for a convex ring), and a vertex average that is
+// strictly inside after rounding to float.
+SPolygonConvexity ComputePolygonConvexity(const SPointNE* polygon, uint16_t pointCount);
+
+/**
+ * isInsidePolygon for a polygon whose descriptor says it is convex.
+ *
+ * The test point is located in the fan of triangles around the descriptor's center by binary
+ * search on the angle (O(log n)); inside its triangle means inside the polygon. Otherwise the
+ * edge closing that wedge faces the point, and the distance to the boundary is unimodal along
+ * the edges facing it, so a walk from there towards smaller distances stops on the nearest edge
+ * (a few steps unless the polygon is very elongated). The result differs from isInsidePolygon
+ * only for centers within float rounding of the boundary, where the ray cast itself is not stable.
+ */
+bool IsInsideConvexPolygon(const SPointNE* polygon, const SPolygonConvexity& convexity, const SPointNE& testPoint, float radiusMeters);
+
+/**
+ * doesLineIntersectPolygon for a convex polygon: a start point inside or on the boundary
+ * (IsInsideConvexPolygon, O(log n)) hits, otherwise a Cyrus-Beck clip of the segment against
+ * the edge half-planes: the segment touches the polygon when the clipped interval is not empty.
+ * Half-planes are widened by the orientation() tolerance, so touching contacts count as in
+ * doSegmentsIntersect. Stops at the first half-plane that leaves nothing of the segment.
+ */
+bool DoesSegmentIntersectConvexPolygon(const SPointNE* polygon, const SPolygonConvexity& convexity, const SPointNE& startPoint, const SPointNE& endPoint);
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+
+/**
+ * Converts a geodetic ring to a query-ready NE polygon in one pass over the ring.
+ *
+ * Each chunk of vertices goes through the reference GeoToEcef and the frame rotation (as GeoToNed),
+ * is narrowed to float and pushed onto outPolygon, where:
+ *   - a vertex equal to the previous kept one (after narrowing) is dropped,
+ *   - a kept vertex lying on the segment between its neighbours (orientation() == 0) is dropped;
+ *     back-tracking spikes are not collinear-between and are kept.
+ * The closing vertices are then cleaned the same way (a repeated first vertex is dropped) and
+ * the ring is reversed if needed so that it runs clockwise on a north-up map, i.e. orientation()
+ * reports 2 at its convex corners.
+ *
+ * outPolygon must hold ringCount points. Returns the kept vertex count, which is below 3 when the
+ * ring degenerates to a point or a line.
+ */
+uint16_t ImportGeoRing(const SLocalFrame& frame, const SPointGeo* ring, uint16_t ringCount, SPointNE* outPolygon);
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Prepared polygon index used by isInsidePolygonPrepared.
+ *
+ * Everything lives in one caller-supplied byte buffer (8-byte aligned), laid out as:
+ *
+ *   SPolygonIndexHeader
+ *   SPointNE  vertices[pointCount]             copy of the polygon
+ *   uint32_t  columnStart[columnCount + 1]     East-axis slabs -> edges whose East range overlaps the slab
+ *   uint16_t  columnEdges[...]
+ *   uint32_t  cellStart[gridRows * gridCols + 1] uniform grid -> edges passing through the cell (padded)
+ *   uint16_t  cellEdges[...]
+ *
+ * Edge k joins vertices k and (k + 1) % pointCount. Slab and cell indices are computed with the
+ * same monotone mapping for edges and queries, so no edge that the linear scan would test is missed.
+ * The ray cast only visits the slab of the test point and the distance pass only visits the cells
+ * covered by the circle; both reuse the exact per-edge tests of isInsidePolygon.
+ */
+
+const uint32_t POLYGON_INDEX_MAGIC = 0x58444950; // "PIDX"
+const size_t POLYGON_INDEX_ALIGNMENT = 8;
+
+struct SPolygonIndexHeader {
+	uint32_t magic;
+	uint32_t totalSize;
+	uint16_t pointCount;
+	uint16_t reserved;
+
+	// Polygon bounding box and largest absolute coordinate (for the query tolerance)
+	float minNorth;
+	float minEast;
+	float maxNorth;
+	float maxEast;
+	float maxAbsCoord;
+
+	// East-axis slabs used by the ray cast
+	uint32_t columnCount;
+	float columnInvWidth;
+
+	// Uniform grid used by the distance pass
+	uint32_t gridRows;
+	uint32_t gridCols;
+	float cellInvSizeNorth;
+	float cellInvSizeEast;
+
+	// Byte offsets of each section from the start of the buffer
+	uint32_t verticesOffset;
+	uint32_t columnStartOffset;
+	uint32_t columnEdgesOffset;
+	uint32_t cellStartOffset;
+	uint32_t cellEdgesOffset;
+};
+
+// Computes the buffer size PreparePolygonIndex needs for this polygon (INDEX_TOO_LARGE above 4 GB).
+EResultState GetPolygonIndexSize(const SPointNE* polygon, uint16_t pointCount, uint32_t* outSizeBytes);
+
+// Builds the index into buffer. The polygon is copied, so it may be released afterwards.
+EResultState PreparePolygonIndex(const SPointNE* polygon, uint16_t pointCount, uint8_t* buffer, uint32_t bufferSize);
+
+// Validates a prepared buffer and returns its header (nullptr on failure).
+const SPolygonIndexHeader* GetPolygonIndexHeader(const uint8_t* prepared, EResultState* outState);
+
+// Same result as isInsidePolygon on the original polygon.
+bool IsInsidePolygonIndexed(const SPolygonIndexHeader* index, const SPointNE& testPoint, float radiusMeters);
+
+// First contact of the ray, testing only the edges stored in the grid cells the ray passes through.
+// Same result as CastRayPolygon on the original polygon.
+SRayHit CastRayIndexed(const SPolygonIndexHeader* index, const SRayNE& ray);
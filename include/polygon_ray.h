@@ -0,0 +1,24 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+
+// SRayHit::edgeIndex when the ray starts inside the polygon
+const uint16_t RAY_START_INSIDE = 0xFFFF;
+
+// End point of the ray; every segment query (doesLineIntersectPolygon and its variants) goes through it.
+SPointNE GetRayEndPoint(const SRayNE& ray);
+
+// Builds the hit for contact parameter t along start -> end (edgeIndex RAY_START_INSIDE for an inside start).
+SRayHit MakeRayHit(const SRayNE& ray, const SPointNE& endPoint, double t, uint16_t edgeIndex);
+
+// Keeps edge k in (bestT, bestEdge) if it is touched by the ray earlier (ties go to the lower edge index).
+void UpdateFirstContact(const SRayNE& ray, const SPointNE& endPoint, const SPointNE& a, const SPointNE& b, uint16_t k, double* bestT, uint16_t* bestEdge);
+
+/**
+ * First boundary contact of the ray with a validated polygon, in one pass over the edges.
+ * isHit is identical to doesLineIntersectPolygon: a start point inside the polygon is a hit
+ * at distance 0, otherwise the earliest edge reported by doSegmentsIntersect wins.
+ */
+SRayHit CastRayPolygon(const SPointNE* polygon, uint16_t pointCount, const SRayNE& ray);
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+
+/**
+ * Multi-ring polygons (an outer boundary plus holes, or several islands) in one flat array.
+ *
+ * Ring r is points[ringOffsets[r]] .. points[ringOffsets[r + 1] - 1] and closes on its first
+ * point, so ringOffsets has ringCount + 1 entries. Counts are 32-bit, so a single ring is not
+ * limited to the 65535 vertices of the uint16_t API. Inside means an odd number of rings around
+ * the point (even-odd rule), whatever the winding of each ring.
+ */
+
+// OK, POLYGON_IS_NULL_PTR / BUFFER_IS_NULL_PTR for null arrays, POLYGON_WITH_LESS_THAN_3_POINTS
+// when there is no ring or a ring has fewer than 3 points (offsets going backwards included).
+EResultState ValidatePolygonRings(const SPointNE* points, const uint32_t* ringOffsets, uint32_t ringCount);
+
+// isInsidePolygon over all rings: one ray-cast pass carries the parity across rings, and only
+// a center outside the zone needs the second pass looking for an edge within the radius.
+// A single ring gives exactly isInsidePolygon.
+bool IsInsidePolygonRings(const SPointNE* points, const uint32_t* ringOffsets, uint32_t ringCount, const SPointNE& testPoint, float radiusMeters);
+
+// doesLineIntersectPolygon over all rings: the start point's parity over every ring, then one pass
+// of boundary and doSegmentsIntersect tests. A single ring gives exactly doesLineIntersectPolygon.
+bool DoesSegmentIntersectPolygonRings(const SPointNE* points, const uint32_t* ringOffsets, uint32_t ringCount, const SPointNE& startPoint, const SPointNE& endPoint);
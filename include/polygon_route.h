@@ -0,0 +1,17 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+
+// SRouteViolation::legIndex when the route is clear
+const uint32_t ROUTE_NO_LEG = 0xFFFFFFFF;
+
+/**
+ * First violation of a validated polygon by the route waypoints[0] -> ... -> waypoints[waypointCount - 1].
+ *
+ * Only the first waypoint is classified with isInsidePolygon. A leg that touches no edge ends on
+ * the same side it started, so the outside state is carried from leg to leg and every later leg
+ * is just tested against the edges with doSegmentsIntersect (no trigonometry, no ray cast).
+ */
+SRouteViolation FindRouteViolation(const SPointNE* polygon, uint16_t pointCount, const SPointNE* waypoints, uint32_t waypointCount);
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+
+// Empty tracker for a validated polygon; the first query does a full evaluation.
+SPolygonTracker MakePolygonTracker(const SPointNE* polygon, uint16_t pointCount);
+
+/**
+ * isInsidePolygon for the tracker's moving point.
+ *
+ * The distance to the boundary changes by at most the displacement d from the anchor, so with
+ * anchor distance D and rounding margin m:
+ *   - anchor inside and d + m < D                 -> still inside, true
+ *   - anchor outside and d + m < D - |radius|     -> circle still clear, false
+ * Otherwise the point is near the boundary: a full ComputePolygonClearance pass answers and
+ * becomes the new anchor. Non-finite positions always take the full pass.
+ */
+bool TrackPolygonQuery(SPolygonTracker& tracker, const SPointNE* polygon, const SPointNE& testPoint, float radiusMeters);
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "api_structs.h"
+
+/**
+ * Exact orientation sign for float coordinates (after Shewchuk's adaptive predicates).
+ *
+ * The determinant det = (q.east - p.east) * (r.north - q.north) - (q.north - p.north) * (r.east - q.east)
+ * is first evaluated in double with the orientation error bound of Shewchuk's orient2d filter;
+ * when |det| clears the bound its sign is certain (a few flops, nearly every call). Otherwise
+ * det is expanded into six float x float products, each exact in double, and summed without
+ * error into a floating-point expansion whose largest component gives the sign.
+ *
+ * Instrumented builds count the calls (OrientQueries) and the exact evaluations (OrientExactFallbacks).
+ *
+ * Returns +1 when det > 0 (orientation() == 1), -1 when det < 0 (orientation() == 2) and 0 only
+ * when the points are exactly collinear. Non-finite inputs give the sign of the rounded determinant,
+ * 0 when it is NaN.
+ */
+int Orient2dSign(const SPointNE& p, const SPointNE& q, const SPointNE& r);
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Scratch arena: bump allocation over caller-supplied memory (the library never uses the heap).
+ *
+ * Allocations are released all at once by rewinding to a mark taken earlier. Running out of
+ * space is reported as BUFFER_TOO_SMALL and leaves the arena unchanged.
+ *
+ * An arena over a nullptr buffer only measures: ArenaReserve hands out offsets without memory,
+ * which lets a Get*Size function and its Prepare* builder share one layout function.
+ */
+
+const uint32_t ARENA_DEFAULT_ALIGNMENT = 8;
+const uint32_t ARENA_MAX_ALIGNMENT = 4096;
+
+// Starts an empty arena over buffer[0, capacity). buffer may be nullptr for a measuring arena.
+EResultState InitArena(SArena& arena, uint8_t* buffer, uint32_t capacity);
+
+// Reserves sizeBytes at the next multiple of alignment (a power of two up to ARENA_MAX_ALIGNMENT)
+// and returns its offset from the arena base.
+EResultState ArenaReserve(SArena& arena, uint64_t sizeBytes, uint32_t alignment, uint32_t* outOffset);
+
+// Reserves count elements of T; nullptr (with outState set) when it does not fit or the arena only measures.
+template <typename T>
+T* ArenaPushArray(SArena& arena, uint64_t count, EResultState* outState, uint32_t alignment = ARENA_DEFAULT_ALIGNMENT) {
+	uint32_t offset = 0;
+	*outState = ArenaReserve(arena, count * sizeof(T), alignment, &offset);
+	if (*outState != EResultState::OK || arena.base == nullptr) {
+		return nullptr;
+	}
+	return reinterpret_cast<T*>(arena.base + offset);
+}
+
+// Releases everything reserved after mark (a previous arena.used value).
+EResultState ArenaRewindTo(SArena& arena, uint32_t mark);
@@ -2,12 +2,16 @@
 #include "api_functions.h"
 #include "cov_spy.h"
 
-#if defined(_DEBUG) || !defined(NDEBUG)
+#if defined(API_FUNCTIONS_INSTRUMENTED)
 
 extern "C" {
-    API_FUNCTIONS bool* GetCoverageArray(ECovFuncID funcId);
+    // Copies every counter and timer (each value is read atomically, the set is not a single instant)
+    API_FUNCTIONS void SnapshotInstrumentation(SInstrumentationSnapshot* outSnapshot);
 
-    API_FUNCTIONS void ResetCoverage();
+    API_FUNCTIONS void ResetInstrumentation();
+
+    // Timers start disabled
+    API_FUNCTIONS void EnableApiTimers(uint8_t enabled);
 }
 
-#endif
\ No newline at end of file
+#endif
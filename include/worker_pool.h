@@ -0,0 +1,44 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Fixed worker pool used by the *Parallel batch functions.
+ *
+ * The pool lives in one caller-supplied buffer (GetWorkerPoolSize bytes, 8-byte aligned). Its
+ * threads are native threads started by InitWorkerPool, so running a job never allocates.
+ * The calling thread is worker 0 and threadCount - 1 pool threads are workers 1 .. threadCount - 1.
+ *
+ * Work is split statically: worker w gets the w-th contiguous range of PartitionRange. Ranges
+ * start on multiples of the caller's granule, so a batch function that processes its input in
+ * granule-sized chunks computes the same values whatever the thread count.
+ */
+
+const uint32_t WORKER_POOL_MAGIC = 0x4C4F4F50; // "POOL"
+const uint32_t WORKER_POOL_MAX_THREADS = 64;
+
+// Runs worker `worker` of `workerCount` on the job context
+typedef void (*TWorkerBody)(void* context, uint32_t worker, uint32_t workerCount);
+
+// Bytes InitWorkerPool needs (independent of the thread count).
+uint32_t WorkerPoolSize();
+
+// Builds the pool in buffer and starts threadCount - 1 threads (1 .. WORKER_POOL_MAX_THREADS).
+// A buffer still holding a started pool is refused (POOL_ALREADY_STARTED): shut it down first.
+EResultState InitWorkerPool(uint8_t* buffer, uint32_t bufferSize, uint32_t threadCount);
+
+// Stops and joins the threads; the buffer may be reused afterwards.
+EResultState ShutdownWorkerPool(uint8_t* pool);
+
+// Number of workers of a started pool, 0 when pool is not one.
+uint32_t WorkerPoolThreadCount(const uint8_t* pool);
+
+// Runs body on every worker and returns when all of them are done. Jobs on one pool are serialized.
+void RunOnWorkerPool(uint8_t* pool, TWorkerBody body, void* context);
+
+// Range [outBegin, outEnd) of worker `worker`: itemCount split into workerCount contiguous ranges
+// whose starts are multiples of granule. Trailing workers may get an empty range.
+void PartitionRange(uint32_t itemCount, uint32_t granule, uint32_t worker, uint32_t workerCount, uint32_t* outBegin, uint32_t* outEnd);
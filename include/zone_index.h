@@ -0,0 +1,81 @@
+#pragma once
+
+#include "api_structs.h"
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Multi-zone index used by QueryZonesCircle / QueryZonesSegment.
+ *
+ * A flat bounding-volume hierarchy over the zone bounding boxes, built into one
+ * caller-supplied byte buffer (8-byte aligned) and free of pointers, laid out as:
+ *
+ *   SZoneIndexHeader
+ *   SZoneIndexNode  nodes[nodeCount]      depth-first; the left child follows its parent
+ *   SZoneRecord     zones[zoneCount]      reordered so every leaf owns a contiguous range
+ *   SPointNE        vertices[vertexCount] copy of all zone polygons
+ *
+ * Boxes are only used to skip zones; every remaining zone is answered by isInsidePolygon
+ * or doesLineIntersectPolygon on its own vertices.
+ */
+
+const uint32_t ZONE_INDEX_MAGIC = 0x58444E5A; // "ZNDX"
+const uint32_t ZONE_INDEX_LEAF_SIZE = 4;
+// Enough for any tree built by PrepareZoneIndex (depth <= 32)
+const uint32_t ZONE_INDEX_MAX_DEPTH = 64;
+
+struct SZoneBounds {
+	float minNorth;
+	float minEast;
+	float maxNorth;
+	float maxEast;
+};
+
+struct SZoneIndexNode {
+	SZoneBounds bounds;
+	uint32_t first;  // leaf: first zone record; inner node: index of the right child
+	uint32_t count;  // leaf: number of zone records; inner node: 0
+};
+
+struct SZoneRecord {
+	SZoneBounds bounds;
+	uint32_t zoneId;
+	uint32_t firstVertex;
+	uint16_t pointCount;
+	uint16_t reserved;
+};
+
+struct SZoneIndexHeader {
+	uint32_t magic;
+	uint32_t totalSize;
+	uint32_t zoneCount;
+	uint32_t nodeCount;
+	uint32_t vertexCount;
+
+	// Largest absolute coordinate over all zones (for the query tolerance)
+	float maxAbsCoord;
+
+	// Byte offsets of each section from the start of the buffer
+	uint32_t nodesOffset;
+	uint32_t zonesOffset;
+	uint32_t verticesOffset;
+};
+
+// Computes the buffer size PrepareZoneIndex needs for these zones (INDEX_TOO_LARGE above 4 GB).
+EResultState GetZoneIndexSize(const uint16_t* zonePointCounts, uint32_t zoneCount, uint32_t* outSizeBytes);
+
+// Builds the index into buffer. Zone z has zonePointCounts[z] vertices, stored back to back in zonePoints.
+// zoneIds may be nullptr, in which case the zone's position is reported as its ID.
+EResultState PrepareZoneIndex(const SPointNE* zonePoints, const uint16_t* zonePointCounts, const uint32_t* zoneIds, uint32_t zoneCount, uint8_t* buffer, uint32_t bufferSize);
+
+// Validates a prepared buffer and returns its header (nullptr on failure).
+const SZoneIndexHeader* GetZoneIndexHeader(const uint8_t* prepared, EResultState* outState);
+
+// IDs of zones for which isInsidePolygon(zone, testPoint, radiusMeters) is true.
+// Writes at most maxZoneIds IDs and returns the total number of hits.
+uint32_t QueryZonesCircleIndexed(const SZoneIndexHeader* index, const SPointNE& testPoint, float radiusMeters, uint32_t* outZoneIds, uint32_t maxZoneIds);
+
+// IDs of zones for which doesLineIntersectPolygon(zone, testPoint, azimuthDegrees, maxLength) is true
+// (maxLength must be positive). Same output convention as QueryZonesCircleIndexed.
+uint32_t QueryZonesSegmentIndexed(const SZoneIndexHeader* index, const SPointNE& testPoint, float azimuthDegrees, float maxLength, uint32_t* outZoneIds, uint32_t maxZoneIds);
@@ -17,6 +17,21 @@ class EResultState(IntEnum):
     POLYGON_WITH_LESS_THAN_3_POINTS = 1
     POLYGON_IS_NULL_PTR = 2
     MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO = 3
+    POINTS_IS_NULL_PTR = 4
+    KERNEL_NOT_SUPPORTED = 5
+    BUFFER_IS_NULL_PTR = 6
+    BUFFER_TOO_SMALL = 7
+    BUFFER_NOT_ALIGNED = 8
+    PREPARED_DATA_INVALID = 9
+    INDEX_TOO_LARGE = 10
+    OUTPUT_TOO_SMALL = 11
+    METHOD_NOT_SUPPORTED = 12
+    ARENA_MARK_INVALID = 13
+    THREAD_COUNT_INVALID = 14
+    THREAD_START_FAILED = 15
+    ROUTE_WITH_LESS_THAN_2_POINTS = 16
+    STRIDE_TOO_SMALL = 17
+    POOL_ALREADY_STARTED = 18
 
 # --- 2. Shared Library Loader ---
 def load_geopoint_library():
@@ -41,13 +56,51 @@ def load_geopoint_library():
             print(f"[INFO] Loaded library from: {lib_path}")
             if sys.platform.startswith("win32"):
                 os.add_dll_directory(os.path.dirname(lib_path))
-            return ctypes.CDLL(lib_path)
+            lib = ctypes.CDLL(lib_path)
+            declare_column_functions(lib)
+            return lib
 
     print(f"[ERROR] Could not find '{lib_name}' in standard build folders.", file=sys.stderr)
     print(f"Searched in: {search_paths}", file=sys.stderr)
     sys.exit(1)
 
-# --- 3. Shared Math Helper ---
+# --- 3. Strided Column Entry Points ---
+# Each takes column base addresses plus one byte stride per column group (0 = packed doubles),
+# so NumPy arrays are passed without copying: column_args(arr) gives (address, stride).
+def declare_column_functions(lib):
+    """Declares the *Columns signatures on a loaded library."""
+    c_double, c_void_p, c_uint16, c_uint32, c_float = ctypes.c_double, ctypes.c_void_p, ctypes.c_uint16, ctypes.c_uint32, ctypes.c_float
+    state_ptr = ctypes.POINTER(ctypes.c_uint8)
+
+    # (originLat, originLon, originAlt, in0, in1, in2, pointCount, inStride, out0, out1, out2, outStride, resultState)
+    for name in ("GeoToNedColumns", "NedToGeoColumns"):
+        func = getattr(lib, name)
+        func.argtypes = [c_double, c_double, c_double, c_void_p, c_void_p, c_void_p, c_uint32, c_uint32,
+                         c_void_p, c_void_p, c_void_p, c_uint32, state_ptr]
+        func.restype = None
+
+    lib.isInsidePolygonColumns.argtypes = [ctypes.POINTER(SPointNE), c_uint16, c_void_p, c_void_p, c_uint32, c_uint32,
+                                           c_float, c_void_p, state_ptr]
+    lib.isInsidePolygonColumns.restype = None
+
+    lib.doesLineIntersectPolygonColumns.argtypes = [ctypes.POINTER(SPointNE), c_uint16, c_void_p, c_void_p, c_void_p, c_void_p,
+                                                    c_uint32, c_uint32, c_void_p, state_ptr]
+    lib.doesLineIntersectPolygonColumns.restype = None
+
+def column_args(array):
+    """(address, byte stride) of a 1-D float64 NumPy array or structured-array field."""
+    if array.dtype.itemsize != 8 or array.dtype.kind != "f":
+        raise TypeError("columns must be float64")
+    if array.ndim != 1:
+        raise ValueError("columns must be 1-D")
+    stride = array.strides[0] if array.shape[0] > 1 else array.itemsize
+    # The library takes an unsigned 32-bit stride: reversed views (< 0) would wrap to ~4 GB and
+    # broadcast columns (0) would be read as packed, so both need np.ascontiguousarray first
+    if stride <= 0 or stride > 0xFFFFFFFF:
+        raise ValueError("column stride %d not supported, pass np.ascontiguousarray(column)" % stride)
+    return array.ctypes.data, stride
+
+# --- 4. Shared Math Helper ---
 def ned_to_geodetic(north, east, origin_lat, origin_lon):
     EARTH_RADIUS = 6371000.0
     lat = origin_lat + math.degrees(north / EARTH_RADIUS)
@@ -0,0 +1,49 @@
+// Compiled with AVX2 + FMA flags (see src/CMakeLists.txt); only called after CPUID dispatch.
+#include "coords_conv_simd.h"
+#include "coords_conv_kernels.h"
+
+#include <immintrin.h>
+
+namespace {
+
+struct SAvx2Ops
+{
+    using V = __m256d;
+    using M = __m256d;
+    static constexpr uint32_t WIDTH = 4;
+
+    static inline V Set1(double a) { return _mm256_set1_pd(a); }
+    static inline V Load(const double* p) { return _mm256_load_pd(p); }
+    static inline void Store(double* p, V a) { _mm256_store_pd(p, a); }
+    static inline V Add(V a, V b) { return _mm256_add_pd(a, b); }
+    static inline V Sub(V a, V b) { return _mm256_sub_pd(a, b); }
+    static inline V Mul(V a, V b) { return _mm256_mul_pd(a, b); }
+    static inline V Div(V a, V b) { return _mm256_div_pd(a, b); }
+    static inline V Sqrt(V a) { return _mm256_sqrt_pd(a); }
+    static inline V Abs(V a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static inline V Min(V a, V b) { return _mm256_min_pd(a, b); }
+    static inline V Max(V a, V b) { return _mm256_max_pd(a, b); }
+    static inline V Round(V a) { return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static inline V Floor(V a) { return _mm256_floor_pd(a); }
+    static inline M Lt(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static inline M Le(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+    static inline M Gt(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static inline M Ge(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+    static inline M Eq(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    static inline M Or(M a, M b) { return _mm256_or_pd(a, b); }
+    static inline V Select(M m, V a, V b) { return _mm256_blendv_pd(b, a, m); }
+};
+
+} // namespace
+
+
+void GeoToEcefAvx2(const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints)
+{
+    TCoordsKernels<SAvx2Ops>::GeoToEcefArray(geoPoints, pointCount, resEcefPoints);
+}
+
+
+void EcefToGeoAvx2(const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints)
+{
+    TCoordsKernels<SAvx2Ops>::EcefToGeoArray(ecefPoints, pointCount, resGeoPoints);
+}
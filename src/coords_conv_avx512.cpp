@@ -0,0 +1,49 @@
+// Compiled with AVX-512F flags (see src/CMakeLists.txt); only called after CPUID dispatch.
+#include "coords_conv_simd.h"
+#include "coords_conv_kernels.h"
+
+#include <immintrin.h>
+
+namespace {
+
+struct SAvx512Ops
+{
+    using V = __m512d;
+    using M = __mmask8;
+    static constexpr uint32_t WIDTH = 8;
+
+    static inline V Set1(double a) { return _mm512_set1_pd(a); }
+    static inline V Load(const double* p) { return _mm512_load_pd(p); }
+    static inline void Store(double* p, V a) { _mm512_store_pd(p, a); }
+    static inline V Add(V a, V b) { return _mm512_add_pd(a, b); }
+    static inline V Sub(V a, V b) { return _mm512_sub_pd(a, b); }
+    static inline V Mul(V a, V b) { return _mm512_mul_pd(a, b); }
+    static inline V Div(V a, V b) { return _mm512_div_pd(a, b); }
+    static inline V Sqrt(V a) { return _mm512_sqrt_pd(a); }
+    static inline V Abs(V a) { return _mm512_abs_pd(a); }
+    static inline V Min(V a, V b) { return _mm512_min_pd(a, b); }
+    static inline V Max(V a, V b) { return _mm512_max_pd(a, b); }
+    static inline V Round(V a) { return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static inline V Floor(V a) { return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+    static inline M Lt(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+    static inline M Le(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+    static inline M Gt(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+    static inline M Ge(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+    static inline M Eq(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+    static inline M Or(M a, M b) { return (M)(a | b); }
+    static inline V Select(M m, V a, V b) { return _mm512_mask_blend_pd(m, b, a); }
+};
+
+} // namespace
+
+
+void GeoToEcefAvx512(const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints)
+{
+    TCoordsKernels<SAvx512Ops>::GeoToEcefArray(geoPoints, pointCount, resEcefPoints);
+}
+
+
+void EcefToGeoAvx512(const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints)
+{
+    TCoordsKernels<SAvx512Ops>::EcefToGeoArray(ecefPoints, pointCount, resGeoPoints);
+}
@@ -49,11 +49,124 @@ void MulMatVec3(const double A[3][3], const double VIn[3], double VOut[3])
     VOut[2] = A[2][0] * VIn[0] + A[2][1] * VIn[1] + A[2][2] * VIn[2];
 }
 
+
+SLocalSeriesFrame ComputeLocalSeriesFrame(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude)
+{
+    SLocalSeriesFrame frame;
+    frame.originLatitudeRad = NavValidateLatitude(originLatitudeDeg * PI / 180.0);
+    frame.originLongitudeRad = NavValidateLongitude(originLongitudeDeg * PI / 180.0);
+    frame.originAltitude = originAltitude;
+    SinCos(frame.originLatitudeRad, frame.sinLat, frame.cosLat);
+
+    // dM/dlat = 3 M e^2 sin(lat) cos(lat) / W^2
+    const double meridian = WGS84::RMFromSinLat(frame.sinLat);
+    frame.meridianRadius = meridian + originAltitude;
+    frame.normalRadius = WGS84::RNFromSinLat(frame.sinLat) + originAltitude;
+    frame.meridianSlope = 1.5 * meridian * WGS84::E2 * frame.sinLat * frame.cosLat / WGS84::W2FromSinLat(frame.sinLat);
+
+    const double tanLat = API_UTILS::safe_div(frame.sinLat, frame.cosLat, INFINITY);
+    frame.boundScale = 0.5 * (1.0 + tanLat * tanLat) / (WGS84::A * WGS84::A);
+    return frame;
+}
+
+
+double GetSeriesErrorBound(const SLocalSeriesFrame& frame, const double horizontalDistance, const double altitudeDelta)
+{
+    const double rho = std::fabs(horizontalDistance);
+    const double dh = std::fabs(altitudeDelta);
+    const double aSq = WGS84::A * WGS84::A;
+    return frame.boundScale * rho * rho * rho + 0.5 * (rho * rho * dh + rho * dh * dh) / aSq + 1e-6;
+}
+
+
+SPointNED GeoToNedSeries(const SLocalSeriesFrame& frame, const SPointGeo& geoPoint, double* outErrorBound)
+{
+    const double a = geoPoint.latitudeDeg * PI / 180.0 - frame.originLatitudeRad;
+    const double b = NavValidateLongitude(geoPoint.longitudeDeg * PI / 180.0 - frame.originLongitudeRad);
+    const double c = geoPoint.altitude - frame.originAltitude;
+
+    SPointNED ned;
+    ned.north = frame.meridianRadius * a + frame.meridianSlope * a * a + a * c + 0.5 * frame.normalRadius * frame.sinLat * frame.cosLat * b * b;
+    ned.east = frame.normalRadius * frame.cosLat * b - frame.meridianRadius * frame.sinLat * a * b + frame.cosLat * b * c;
+    ned.down = -c + 0.5 * frame.meridianRadius * a * a + 0.5 * frame.normalRadius * frame.cosLat * frame.cosLat * b * b;
+
+    // Written so that NaN gives an infinite bound
+    const bool isSmall = std::fabs(a) <= SERIES_MAX_ANGLE_RAD && std::fabs(b) <= SERIES_MAX_ANGLE_RAD;
+    *outErrorBound = isSmall ? GetSeriesErrorBound(frame, std::sqrt(ned.north * ned.north + ned.east * ned.east), c) : INFINITY;
+    return ned;
+}
+
+
+SPointGeo NedToGeoSeries(const SLocalSeriesFrame& frame, const SPointNED& nedPoint, double* outErrorBound)
+{
+    // First-order start, then fixed-point steps on the forward series (each gains about rho / A)
+    double a = nedPoint.north / frame.meridianRadius;
+    double b = API_UTILS::safe_div(nedPoint.east, frame.normalRadius * frame.cosLat);
+    double c = -nedPoint.down;
+    for (int iter = 0; iter < 3; ++iter) {
+        c = -nedPoint.down + 0.5 * frame.meridianRadius * a * a + 0.5 * frame.normalRadius * frame.cosLat * frame.cosLat * b * b;
+        a = (nedPoint.north - frame.meridianSlope * a * a - 0.5 * frame.normalRadius * frame.sinLat * frame.cosLat * b * b) / (frame.meridianRadius + c);
+        b = API_UTILS::safe_div(nedPoint.east, frame.normalRadius * frame.cosLat - frame.meridianRadius * frame.sinLat * a + frame.cosLat * c);
+    }
+
+    SPointGeo geo;
+    geo.latitudeDeg = (frame.originLatitudeRad + a) * 180.0 / PI;
+    geo.longitudeDeg = NavValidateLongitude(frame.originLongitudeRad + b) * 180.0 / PI;
+    geo.altitude = frame.originAltitude + c;
+
+    // Written so that NaN gives an infinite bound
+    const bool isSmall = std::fabs(a) <= SERIES_MAX_ANGLE_RAD && std::fabs(b) <= SERIES_MAX_ANGLE_RAD;
+    *outErrorBound = isSmall ? GetSeriesErrorBound(frame, std::sqrt(nedPoint.north * nedPoint.north + nedPoint.east * nedPoint.east), c) : INFINITY;
+    return geo;
+}
+
 // --- main functions ---
 
+template <typename TEllipsoid>
+SLocalFrame ComputeLocalFrame(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude)
+{
+    double originLatitudeRad = originLatitudeDeg * PI / 180.0;
+    double originLongitudeRad = originLongitudeDeg * PI / 180.0;
+
+    double originlocalLatitudeRad = NavValidateLatitude(originLatitudeRad);
+    double originlocalLongitudeRad = NavValidateLongitude(originLongitudeRad);
+    double sinLat, cosLat, sinLong, cosLong;
+    SinCos(originlocalLatitudeRad, sinLat, cosLat);
+    SinCos(originlocalLongitudeRad, sinLong, cosLong);
+
+    SLocalFrame frame;
+    frame.ecefToNed[0][0] = -sinLat * cosLong;
+    frame.ecefToNed[0][1] = -sinLat * sinLong;
+    frame.ecefToNed[0][2] = cosLat;
+    frame.ecefToNed[1][0] = -sinLong;
+    frame.ecefToNed[1][1] = cosLong;
+    frame.ecefToNed[1][2] = 0.0;
+    frame.ecefToNed[2][0] = -cosLat * cosLong;
+    frame.ecefToNed[2][1] = -cosLat * sinLong;
+    frame.ecefToNed[2][2] = -sinLat;
+
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            frame.nedToEcef[i][j] = frame.ecefToNed[j][i];
+        }
+    }
+
+    // Origin in ECEF from the sines and cosines above (same as GeoToEcef on the validated origin)
+    typedef SEllipsoidConstants<TEllipsoid> Ellipsoid;
+    const double rn = Ellipsoid::RNFromSinLat(sinLat);
+    const double rnPlusHCosLat = (rn + originAltitude) * cosLat;
+    frame.originEcef.x = rnPlusHCosLat * cosLong;
+    frame.originEcef.y = rnPlusHCosLat * sinLong;
+    frame.originEcef.z = (Ellipsoid::ONE_MINUS_E2 * rn + originAltitude) * sinLat;
+
+    return frame;
+}
+
+
+template <typename TEllipsoid>
 SPointECEF GeoToEcef(const SPointGeo geoPoint)
 {
-    const double oneMinusE2 = 1 - WGS84::E2;
+    typedef SEllipsoidConstants<TEllipsoid> Ellipsoid;
 
     // Latitude is valid in [-pi/2, pi/2]
     double latitudeRad = geoPoint.latitudeDeg * PI / 180.0;
@@ -63,26 +176,29 @@ SPointECEF GeoToEcef(const SPointGeo geoPoint)
 
     double altitude = geoPoint.altitude;
 
+    double sinLat, cosLat, sinLong, cosLong;
+    SinCos(latitudeRad, sinLat, cosLat);
+    SinCos(longitudeRad, sinLong, cosLong);
+
     // Normal (east/west) prime vertical curvature radii (m)
-    double rn = WGS84::RN(latitudeRad);
+    double rn = Ellipsoid::RNFromSinLat(sinLat);
 
-    double rn_plus_h_cos_lat = (rn + altitude) * std::cos(latitudeRad);
+    double rn_plus_h_cos_lat = (rn + altitude) * cosLat;
 
     // ECEF (m) position coordinates
     SPointECEF ecef;
-    ecef.x = rn_plus_h_cos_lat * std::cos(longitudeRad);
-    ecef.y = rn_plus_h_cos_lat * std::sin(longitudeRad);
-    ecef.z = (oneMinusE2 * rn + altitude) * std::sin(latitudeRad);
+    ecef.x = rn_plus_h_cos_lat * cosLong;
+    ecef.y = rn_plus_h_cos_lat * sinLong;
+    ecef.z = (Ellipsoid::ONE_MINUS_E2 * rn + altitude) * sinLat;
 
     return ecef;
 }
 
 
+template <typename TEllipsoid>
 SPointGeo EcefToGeo(const SPointECEF ecefPoint)
 {
-    const double oneMinusE2 = 1 - WGS84::E2;
-    const double sqrtOneMinusE2 = std::sqrt(oneMinusE2);
-    const double invOneMinusE2 = 1 / oneMinusE2;
+    typedef SEllipsoidConstants<TEllipsoid> Ellipsoid;
 
     double x = ecefPoint.x;
     double y = ecefPoint.y;
@@ -91,28 +207,31 @@ SPointGeo EcefToGeo(const SPointECEF ecefPoint)
     double longitudeRad = std::atan2(y, x);
 
     double normXPosYPos = API_UTILS::safe_sqrt((y * y + x * x), 1.0);
-    double inv1 = API_UTILS::safe_div(1.0, (normXPosYPos * sqrtOneMinusE2), 1.0);
+    double inv1 = API_UTILS::safe_div(1.0, (normXPosYPos * Ellipsoid::SQRT_ONE_MINUS_E2), 1.0);
     double u = std::atan(z * inv1);
-    double tmp2 = z + WGS84::E2 * invOneMinusE2 * EARTH_CONSTS::R0 * sqrtOneMinusE2 * std::sin(u) * std::sin(u) * std::sin(u);
-    double den = normXPosYPos - WGS84::E2 * EARTH_CONSTS::R0 * std::cos(u) * std::cos(u) * std::cos(u);
+    double sinU, cosU;
+    SinCos(u, sinU, cosU);
+    double tmp2 = z + Ellipsoid::EP2_B * sinU * sinU * sinU;
+    double den = normXPosYPos - Ellipsoid::E2_A * cosU * cosU * cosU;
     double invDen = API_UTILS::safe_div(1.0, den, 1.0);
     double latitudeRad = std::atan(tmp2 * invDen);
-    double sinlat = std::sin(latitudeRad);
+    double sinlat, coslat;
+    SinCos(latitudeRad, sinlat, coslat);
     double sinlat2 = sinlat * sinlat;
-    double coslat = std::cos(latitudeRad);
+    double w = API_UTILS::safe_sqrt((1.0 - Ellipsoid::E2 * sinlat2), 1.0);
     double inv2;
     double altitude;
 
 
     if (sinlat2 <= 0.5)
     {
-        inv2 = API_UTILS::safe_div(1.0, (API_UTILS::safe_sqrt((1.0 - WGS84::E2 * sinlat2), 1.0) * coslat), 1.0);
-        altitude = (normXPosYPos * API_UTILS::safe_sqrt((1.0 - WGS84::E2 * sinlat2), 1.0) - EARTH_CONSTS::R0 * coslat) * inv2;
+        inv2 = API_UTILS::safe_div(1.0, (w * coslat), 1.0);
+        altitude = (normXPosYPos * w - Ellipsoid::A * coslat) * inv2;
     }
     else
     {
-        inv2 = API_UTILS::safe_div(1.0, (API_UTILS::safe_sqrt((1.0 - WGS84::E2 * sinlat2), 1.0) * sinlat), 1.0);
-        altitude = (z * API_UTILS::safe_sqrt((1.0 - WGS84::E2 * sinlat2), 1.0) - EARTH_CONSTS::R0 * oneMinusE2 * sinlat) * inv2;
+        inv2 = API_UTILS::safe_div(1.0, (w * sinlat), 1.0);
+        altitude = (z * w - Ellipsoid::A * Ellipsoid::ONE_MINUS_E2 * sinlat) * inv2;
     }
 
     SPointGeo geo;
@@ -124,39 +243,194 @@ SPointGeo EcefToGeo(const SPointECEF ecefPoint)
 }
 
 
+template <typename TEllipsoid>
+SPointGeo EcefToGeoVermeille(const SPointECEF ecefPoint)
+{
+    // Vermeille (2002), closed form; valid everywhere except deep inside the Earth (evolute)
+    typedef SEllipsoidConstants<TEllipsoid> Ellipsoid;
+    constexpr double e4 = Ellipsoid::E2 * Ellipsoid::E2;
+    constexpr double invA2 = 1.0 / (Ellipsoid::A * Ellipsoid::A);
+
+    double x = ecefPoint.x;
+    double y = ecefPoint.y;
+    double z = ecefPoint.z;
+
+    double horizontal2 = x * x + y * y;
+    double horizontal = std::sqrt(horizontal2);
+
+    double p = horizontal2 * invA2;
+    double q = Ellipsoid::ONE_MINUS_E2 * z * z * invA2;
+    double r = (p + q - e4) / 6.0;
+    double s = API_UTILS::safe_div(e4 * p * q, 4.0 * r * r * r);
+    double t = std::cbrt(1.0 + s + API_UTILS::safe_sqrt(s * (2.0 + s)));
+    double u = r * (1.0 + t + 1.0 / t);
+    double v = std::sqrt(u * u + e4 * q);
+    double w = Ellipsoid::E2 * (u + v - q) / (2.0 * v);
+    double k = std::sqrt(u + v + w * w) - w;
+    double d = k * horizontal / (k + Ellipsoid::E2);
+    double dz = std::sqrt(d * d + z * z);
+
+    SPointGeo geo;
+    geo.latitudeDeg = 2.0 * std::atan2(z, d + dz) * 180.0 / PI;
+    geo.longitudeDeg = std::atan2(y, x) * 180.0 / PI;
+    geo.altitude = (k + Ellipsoid::E2 - 1.0) / k * dz;
+
+    return geo;
+}
+
+
+template <typename TEllipsoid>
+SPointGeo EcefToGeoOlson(const SPointECEF ecefPoint)
+{
+    // Olson (1996): series first guess of the latitude, then one Newton correction
+    typedef SEllipsoidConstants<TEllipsoid> Ellipsoid;
+    constexpr double a1 = Ellipsoid::E2_A;
+    constexpr double a2 = a1 * a1;
+    constexpr double a3 = a1 * Ellipsoid::E2 / 2.0;
+    constexpr double a4 = 2.5 * a2;
+    constexpr double a5 = a1 + a3;
+    constexpr double a6 = Ellipsoid::ONE_MINUS_E2;
+
+    double x = ecefPoint.x;
+    double y = ecefPoint.y;
+    double z = ecefPoint.z;
+
+    double zAbs = std::fabs(z);
+    double horizontal2 = x * x + y * y;
+    double horizontal = std::sqrt(horizontal2);
+    double radius2 = horizontal2 + z * z;
+    double radius = std::sqrt(radius2);
+
+    double sin2 = z * z / radius2;
+    double cos2 = horizontal2 / radius2;
+    double u = a2 / radius;
+    double v = a3 - a4 / radius;
+
+    double sinlat, coslat, sinlat2, latitudeRad;
+    if (cos2 > 0.3) {
+        sinlat = (zAbs / radius) * (1.0 + cos2 * (a1 + u + sin2 * v) / radius);
+        latitudeRad = std::asin(sinlat);
+        sinlat2 = sinlat * sinlat;
+        coslat = std::sqrt(1.0 - sinlat2);
+    }
+    else {
+        coslat = (horizontal / radius) * (1.0 - sin2 * (a5 - u - cos2 * v) / radius);
+        latitudeRad = std::acos(coslat);
+        sinlat2 = 1.0 - coslat * coslat;
+        sinlat = std::sqrt(sinlat2);
+    }
+
+    double g = Ellipsoid::W2FromSinLat(sinlat);
+    double rn = Ellipsoid::A / std::sqrt(g);
+    double rf = a6 * rn;
+    u = horizontal - rn * coslat;
+    v = zAbs - rf * sinlat;
+    double f = coslat * u + sinlat * v;
+    double m = coslat * v - sinlat * u;
+    double correction = m / (rf / g + f);
+    latitudeRad += correction;
+
+    SPointGeo geo;
+    geo.latitudeDeg = ((z < 0.0) ? -latitudeRad : latitudeRad) * 180.0 / PI;
+    geo.longitudeDeg = std::atan2(y, x) * 180.0 / PI;
+    geo.altitude = f + m * correction / 2.0;
+
+    return geo;
+}
+
+
+template <typename TEllipsoid>
+SPointNED EcefToNed(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const SPointECEF ecefPoint)
+{
+    return EcefToNed(ComputeLocalFrame<TEllipsoid>(originLatitudeDeg, originLongitudeDeg, originAltitude), ecefPoint);
+}
+
+
+template <typename TEllipsoid>
+SPointECEF NedToEcef(const double originLatitudeDeg, const double originLongitudeDeg, const double altitude, const SPointNED nedPoint)
+{
+    return NedToEcef(ComputeLocalFrame<TEllipsoid>(originLatitudeDeg, originLongitudeDeg, altitude), nedPoint);
+}
+
+
+#define INSTANTIATE_COORDS_CORE(TEllipsoid) \
+    template SLocalFrame ComputeLocalFrame<TEllipsoid>(const double, const double, const double); \
+    template SPointECEF GeoToEcef<TEllipsoid>(const SPointGeo); \
+    template SPointGeo EcefToGeo<TEllipsoid>(const SPointECEF); \
+    template SPointGeo EcefToGeoVermeille<TEllipsoid>(const SPointECEF); \
+    template SPointGeo EcefToGeoOlson<TEllipsoid>(const SPointECEF); \
+    template SPointNED EcefToNed<TEllipsoid>(const double, const double, const double, const SPointECEF); \
+    template SPointECEF NedToEcef<TEllipsoid>(const double, const double, const double, const SPointNED);
+
+INSTANTIATE_COORDS_CORE(SWgs84Ellipsoid)
+INSTANTIATE_COORDS_CORE(SGrs80Ellipsoid)
+
+#undef INSTANTIATE_COORDS_CORE
+
+// --- WGS84 wrappers ---
+
+SLocalFrame ComputeLocalFrame(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude)
+{
+    return ComputeLocalFrame<SWgs84Ellipsoid>(originLatitudeDeg, originLongitudeDeg, originAltitude);
+}
+
+
+SPointECEF GeoToEcef(const SPointGeo geoPoint)
+{
+    return GeoToEcef<SWgs84Ellipsoid>(geoPoint);
+}
+
+
+SPointGeo EcefToGeo(const SPointECEF ecefPoint)
+{
+    return EcefToGeo<SWgs84Ellipsoid>(ecefPoint);
+}
+
+
+SPointGeo EcefToGeoVermeille(const SPointECEF ecefPoint)
+{
+    return EcefToGeoVermeille<SWgs84Ellipsoid>(ecefPoint);
+}
+
+
+SPointGeo EcefToGeoOlson(const SPointECEF ecefPoint)
+{
+    return EcefToGeoOlson<SWgs84Ellipsoid>(ecefPoint);
+}
+
+
+SPointGeo EcefToGeo(const SPointECEF ecefPoint, EEcefToGeoMethod method)
+{
+    switch (method) {
+    case EEcefToGeoMethod::ECEF_TO_GEO_VERMEILLE: return EcefToGeoVermeille(ecefPoint);
+    case EEcefToGeoMethod::ECEF_TO_GEO_OLSON: return EcefToGeoOlson(ecefPoint);
+    default: return EcefToGeo(ecefPoint);
+    }
+}
+
+
 SPointNED EcefToNed(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const SPointECEF ecefPoint)
 {
-    double originlatitudeRad = originLatitudeDeg * PI / 180.0;
-    double originlongitudeRad = originLongitudeDeg * PI / 180.0;
+    return EcefToNed<SWgs84Ellipsoid>(originLatitudeDeg, originLongitudeDeg, originAltitude, ecefPoint);
+}
 
-    double originlocalLatitudeRad = NavValidateLatitude(originlatitudeRad);
-    double originlocalLongitudeRad = NavValidateLongitude(originlongitudeRad);
-    double sinLat = std::sin(originlocalLatitudeRad);
-    double cosLat = std::cos(originlocalLatitudeRad);
-    double sinLong = std::sin(originlocalLongitudeRad);
-    double cosLong = std::cos(originlocalLongitudeRad);
 
-    SPointGeo originInGeo = { originlocalLatitudeRad * 180.0 / PI, originlocalLongitudeRad * 180.0 / PI, originAltitude };
-    SPointECEF originInEcef = GeoToEcef(originInGeo);
+SPointECEF NedToEcef(const double originLatitudeDeg, const double originLongitudeDeg, const double altitude, const SPointNED nedPoint)
+{
+    return NedToEcef<SWgs84Ellipsoid>(originLatitudeDeg, originLongitudeDeg, altitude, nedPoint);
+}
+
+// --- Frame-based conversions ---
 
-    double deltaX = ecefPoint.x - originInEcef.x;
-    double deltaY = ecefPoint.y - originInEcef.y;
-    double deltaZ = ecefPoint.z - originInEcef.z;
+SPointNED EcefToNed(const SLocalFrame& frame, const SPointECEF ecefPoint)
+{
+    double deltaX = ecefPoint.x - frame.originEcef.x;
+    double deltaY = ecefPoint.y - frame.originEcef.y;
+    double deltaZ = ecefPoint.z - frame.originEcef.z;
     double deltaEcefVec[3] = { deltaX,deltaY,deltaZ };
-    
-    double tempMat[3][3];
-    tempMat[0][0] = -sinLat * cosLong;
-    tempMat[0][1] = -sinLat * sinLong;
-    tempMat[0][2] = cosLat;
-    tempMat[1][0] = -sinLong;
-    tempMat[1][1] = cosLong;
-    tempMat[1][2] = 0.0;
-    tempMat[2][0] = -cosLat * cosLong;
-    tempMat[2][1] = -cosLat * sinLong;
-    tempMat[2][2] = -sinLat;
 
     double nedVec[3];
-    MulMatVec3(tempMat, deltaEcefVec, nedVec);
+    MulMatVec3(frame.ecefToNed, deltaEcefVec, nedVec);
 
     SPointNED ned;
     ned.north = nedVec[0];
@@ -167,40 +441,16 @@ SPointNED EcefToNed(const double originLatitudeDeg, const double originLongitude
 }
 
 
-SPointECEF NedToEcef(const double originLatitudeDeg, const double originLongitudeDeg, const double altitude, const SPointNED nedPoint)
+SPointECEF NedToEcef(const SLocalFrame& frame, const SPointNED nedPoint)
 {
-    double originLatitudeRad = originLatitudeDeg * PI / 180.0;;
-    double originLongitudeRad = originLongitudeDeg * PI / 180.0;
-
-    double originlocalLatitudeRad = NavValidateLatitude(originLatitudeRad);
-    double originlocalLongitudeRad = NavValidateLongitude(originLongitudeRad);
-    double sinLat = std::sin(originlocalLatitudeRad);
-    double cosLat = std::cos(originlocalLatitudeRad);
-    double sinLong = std::sin(originlocalLongitudeRad);
-    double cosLong = std::cos(originlocalLongitudeRad);
-
-    double tempMat[3][3];
-    tempMat[0][0] = -sinLat * cosLong;
-    tempMat[1][0] = -sinLat * sinLong;
-    tempMat[2][0] = cosLat;
-    tempMat[0][1] = -sinLong;
-    tempMat[1][1] = cosLong;
-    tempMat[2][1] = 0.0;
-    tempMat[0][2] = -cosLat * cosLong;
-    tempMat[1][2] = -cosLat * sinLong;
-    tempMat[2][2] = -sinLat;
-
     double nedVec[3] = { nedPoint.north, nedPoint.east, nedPoint.down };
     double ecefVec[3];
-    MulMatVec3(tempMat, nedVec, ecefVec);
+    MulMatVec3(frame.nedToEcef, nedVec, ecefVec);
 
-    SPointGeo originInGeo = { originlocalLatitudeRad * 180.0 / PI, originlocalLongitudeRad * 180.0 / PI, altitude };
-    SPointECEF originInEcef = GeoToEcef(originInGeo);
-    
     SPointECEF ecef;
-    ecef.x = ecefVec[0] + originInEcef.x;
-    ecef.y = ecefVec[1] + originInEcef.y;
-    ecef.z = ecefVec[2] + originInEcef.z;
+    ecef.x = ecefVec[0] + frame.originEcef.x;
+    ecef.y = ecefVec[1] + frame.originEcef.y;
+    ecef.z = ecefVec[2] + frame.originEcef.z;
 
     return ecef;
 }
@@ -0,0 +1,208 @@
+#include "coords_conv_simd.h"
+#include "coords_conv_kernels.h"
+
+#include <cmath>
+
+#if defined(API_FUNCTIONS_X86_KERNELS)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+// --- Scalar polynomial kernel (fallback when no SIMD ISA is available) ---
+
+namespace {
+
+struct SScalarOps
+{
+    using V = double;
+    using M = bool;
+    static constexpr uint32_t WIDTH = 1;
+
+    static inline V Set1(double a) { return a; }
+    static inline V Load(const double* p) { return *p; }
+    static inline void Store(double* p, V a) { *p = a; }
+    static inline V Add(V a, V b) { return a + b; }
+    static inline V Sub(V a, V b) { return a - b; }
+    static inline V Mul(V a, V b) { return a * b; }
+    static inline V Div(V a, V b) { return a / b; }
+    static inline V Sqrt(V a) { return std::sqrt(a); }
+    static inline V Abs(V a) { return std::fabs(a); }
+    static inline V Min(V a, V b) { return (a < b) ? a : b; }
+    static inline V Max(V a, V b) { return (a > b) ? a : b; }
+    static inline V Round(V a) { return std::nearbyint(a); }
+    static inline V Floor(V a) { return std::floor(a); }
+    static inline M Lt(V a, V b) { return a < b; }
+    static inline M Le(V a, V b) { return a <= b; }
+    static inline M Gt(V a, V b) { return a > b; }
+    static inline M Ge(V a, V b) { return a >= b; }
+    static inline M Eq(V a, V b) { return a == b; }
+    static inline M Or(M a, M b) { return a || b; }
+    static inline V Select(M m, V a, V b) { return m ? a : b; }
+};
+
+} // namespace
+
+
+void GeoToEcefReference(const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints)
+{
+    for (uint32_t i = 0; i < pointCount; ++i) {
+        resEcefPoints[i] = GeoToEcef(geoPoints[i]);
+    }
+}
+
+
+void EcefToGeoReference(const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints)
+{
+    for (uint32_t i = 0; i < pointCount; ++i) {
+        resGeoPoints[i] = EcefToGeo(ecefPoints[i]);
+    }
+}
+
+
+void GeoToEcefScalar(const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints)
+{
+    TCoordsKernels<SScalarOps>::GeoToEcefArray(geoPoints, pointCount, resEcefPoints);
+}
+
+
+void EcefToGeoScalar(const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints)
+{
+    TCoordsKernels<SScalarOps>::EcefToGeoArray(ecefPoints, pointCount, resGeoPoints);
+}
+
+// --- CPU feature detection ---
+
+#if defined(API_FUNCTIONS_X86_KERNELS)
+namespace {
+
+void Cpuid(uint32_t leaf, uint32_t subLeaf, uint32_t regs[4])
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)subLeaf);
+    for (int i = 0; i < 4; ++i) regs[i] = (uint32_t)info[i];
+#else
+    __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+uint64_t ReadXcr0()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+ECoordsKernel DetectBestKernel()
+{
+    uint32_t regs[4];
+    Cpuid(0, 0, regs);
+    const uint32_t maxLeaf = regs[0];
+    if (maxLeaf < 7) return ECoordsKernel::KERNEL_SCALAR;
+
+    Cpuid(1, 0, regs);
+    const bool osxsave = (regs[2] & (1u << 27)) != 0;
+    const bool avx = (regs[2] & (1u << 28)) != 0;
+    const bool fma = (regs[2] & (1u << 12)) != 0;
+    if (!osxsave || !avx || !fma) return ECoordsKernel::KERNEL_SCALAR;
+
+    // The OS must save the YMM (and for AVX-512 the opmask/ZMM) state
+    const uint64_t xcr0 = ReadXcr0();
+    const bool ymmState = (xcr0 & 0x6) == 0x6;
+    const bool zmmState = (xcr0 & 0xE6) == 0xE6;
+
+    Cpuid(7, 0, regs);
+    const bool avx2 = (regs[1] & (1u << 5)) != 0;
+    const bool avx512f = (regs[1] & (1u << 16)) != 0;
+
+    if (avx512f && zmmState) return ECoordsKernel::KERNEL_AVX512;
+    if (avx2 && ymmState) return ECoordsKernel::KERNEL_AVX2;
+    return ECoordsKernel::KERNEL_SCALAR;
+}
+
+} // namespace
+#endif
+
+
+ECoordsKernel GetBestCoordsKernel()
+{
+#if defined(API_FUNCTIONS_X86_KERNELS)
+    static const ECoordsKernel bestKernel = DetectBestKernel();
+    return bestKernel;
+#else
+    return ECoordsKernel::KERNEL_SCALAR;
+#endif
+}
+
+
+bool IsCoordsKernelSupported(ECoordsKernel kernel)
+{
+    switch (kernel) {
+    case ECoordsKernel::KERNEL_AUTO:
+    case ECoordsKernel::KERNEL_REFERENCE:
+    case ECoordsKernel::KERNEL_SCALAR:
+        return true;
+    case ECoordsKernel::KERNEL_AVX2:
+        return GetBestCoordsKernel() >= ECoordsKernel::KERNEL_AVX2;
+    case ECoordsKernel::KERNEL_AVX512:
+        return GetBestCoordsKernel() >= ECoordsKernel::KERNEL_AVX512;
+    }
+    return false;
+}
+
+
+void GeoToEcefDispatch(ECoordsKernel kernel, const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints)
+{
+    if (kernel == ECoordsKernel::KERNEL_AUTO) {
+        kernel = GetBestCoordsKernel();
+    }
+
+    switch (kernel) {
+#if defined(API_FUNCTIONS_X86_KERNELS)
+    case ECoordsKernel::KERNEL_AVX512:
+        GeoToEcefAvx512(geoPoints, pointCount, resEcefPoints);
+        break;
+    case ECoordsKernel::KERNEL_AVX2:
+        GeoToEcefAvx2(geoPoints, pointCount, resEcefPoints);
+        break;
+#endif
+    case ECoordsKernel::KERNEL_SCALAR:
+        GeoToEcefScalar(geoPoints, pointCount, resEcefPoints);
+        break;
+    default:
+        GeoToEcefReference(geoPoints, pointCount, resEcefPoints);
+        break;
+    }
+}
+
+
+void EcefToGeoDispatch(ECoordsKernel kernel, const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints)
+{
+    if (kernel == ECoordsKernel::KERNEL_AUTO) {
+        kernel = GetBestCoordsKernel();
+    }
+
+    switch (kernel) {
+#if defined(API_FUNCTIONS_X86_KERNELS)
+    case ECoordsKernel::KERNEL_AVX512:
+        EcefToGeoAvx512(ecefPoints, pointCount, resGeoPoints);
+        break;
+    case ECoordsKernel::KERNEL_AVX2:
+        EcefToGeoAvx2(ecefPoints, pointCount, resGeoPoints);
+        break;
+#endif
+    case ECoordsKernel::KERNEL_SCALAR:
+        EcefToGeoScalar(ecefPoints, pointCount, resGeoPoints);
+        break;
+    default:
+        EcefToGeoReference(ecefPoints, pointCount, resGeoPoints);
+        break;
+    }
+}
@@ -2,29 +2,230 @@
 #include "test_utils.h"
 #include "no_heap.h"
 #include "cov_spy.h"
+#include "coords_conv_simd.h"
+#include "polygon_index.h"
+#include "polygon_batch.h"
+#include "zone_index.h"
+#include "polygon_ray.h"
+#include "polygon_clearance.h"
+#include "polygon_bounds.h"
+#include "scratch_arena.h"
+#include "worker_pool.h"
+#include "polygon_route.h"
+#include "polygon_tracker.h"
+#include "polygon_import.h"
+#include "polygon_convex.h"
+#include "polygon_rings.h"
 
 #include <cstddef>   // for nullptr
 
-#if defined(_DEBUG) || !defined(NDEBUG)
-bool g_cov_map[(int)ECovFuncID::MAX_FUNCS][MAX_POINTS_PER_FUNC] = { false };
+#if defined(API_FUNCTIONS_INSTRUMENTED)
+std::atomic<uint64_t> g_cov_counters[(int)ECovFuncID::MAX_FUNCS][MAX_POINTS_PER_FUNC];
+std::atomic<uint64_t> g_reject_counters[(int)ERejectCounterID::MAX_REJECT_COUNTERS];
+std::atomic<uint64_t> g_predicate_counters[(int)EPredicateCounterID::MAX_PREDICATE_COUNTERS];
+std::atomic<uint64_t> g_timer_calls[(int)EApiTimerID::MAX_API_TIMERS];
+std::atomic<uint64_t> g_timer_cycles[(int)EApiTimerID::MAX_API_TIMERS];
+std::atomic<bool> g_timers_enabled(false);
 
-bool* GetCoverageArray(ECovFuncID funcId) {
-    return g_cov_map[(int)funcId];
+void SnapshotInstrumentation(SInstrumentationSnapshot* outSnapshot) {
+    if (outSnapshot == nullptr) {
+        return;
+    }
+    for (int i = 0; i < (int)ECovFuncID::MAX_FUNCS; ++i) {
+        for (int j = 0; j < MAX_POINTS_PER_FUNC; ++j) {
+            outSnapshot->covPoints[i][j] = g_cov_counters[i][j].load(std::memory_order_relaxed);
+        }
+    }
+    for (int i = 0; i < (int)ERejectCounterID::MAX_REJECT_COUNTERS; ++i) {
+        outSnapshot->rejectCounters[i] = g_reject_counters[i].load(std::memory_order_relaxed);
+    }
+    for (int i = 0; i < (int)EPredicateCounterID::MAX_PREDICATE_COUNTERS; ++i) {
+        outSnapshot->predicateCounters[i] = g_predicate_counters[i].load(std::memory_order_relaxed);
+    }
+    for (int i = 0; i < (int)EApiTimerID::MAX_API_TIMERS; ++i) {
+        outSnapshot->timerCalls[i] = g_timer_calls[i].load(std::memory_order_relaxed);
+        outSnapshot->timerCycles[i] = g_timer_cycles[i].load(std::memory_order_relaxed);
+    }
 }
 
-void ResetCoverage() {
+void ResetInstrumentation() {
     for (int i = 0; i < (int)ECovFuncID::MAX_FUNCS; ++i) {
         for (int j = 0; j < MAX_POINTS_PER_FUNC; ++j) {
-            g_cov_map[i][j] = false;
+            g_cov_counters[i][j].store(0, std::memory_order_relaxed);
         }
     }
+    for (int i = 0; i < (int)ERejectCounterID::MAX_REJECT_COUNTERS; ++i) {
+        g_reject_counters[i].store(0, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < (int)EPredicateCounterID::MAX_PREDICATE_COUNTERS; ++i) {
+        g_predicate_counters[i].store(0, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < (int)EApiTimerID::MAX_API_TIMERS; ++i) {
+        g_timer_calls[i].store(0, std::memory_order_relaxed);
+        g_timer_cycles[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void EnableApiTimers(uint8_t enabled) {
+    g_timers_enabled.store(enabled != 0, std::memory_order_relaxed);
 }
 #endif
 
+// Points converted per chunk by the batch conversions (stack buffers, no heap)
+const uint32_t BATCH_CHUNK_SIZE = 64;
+
+// --- Chunked conversions ---
+
+namespace {
+
+// Streams pointCount points through the reference GeoToEcef in fixed-size chunks, so every
+// result is bit-identical to GeoToNed; load(i) returns input point i and store(i, ned) receives its result.
+// The approximate SIMD kernels stay behind GeoToEcefArray / EcefToGeoArray, where the caller picks them.
+template <typename TLoad, typename TStore>
+void GeoToNedChunked(const SLocalFrame& frame, uint32_t pointCount, TLoad load, TStore store) {
+    SPointGeo geoChunk[BATCH_CHUNK_SIZE];
+    SPointECEF ecefChunk[BATCH_CHUNK_SIZE];
+    for (uint32_t base = 0; base < pointCount; base += BATCH_CHUNK_SIZE) {
+        const uint32_t chunkCount = MIN(pointCount - base, BATCH_CHUNK_SIZE);
+        for (uint32_t k = 0; k < chunkCount; ++k) {
+            geoChunk[k] = load(base + k);
+        }
+
+        GeoToEcefDispatch(ECoordsKernel::KERNEL_REFERENCE, geoChunk, chunkCount, ecefChunk);
+
+        for (uint32_t k = 0; k < chunkCount; ++k) {
+            store(base + k, EcefToNed(frame, ecefChunk[k]));
+        }
+    }
+}
+
+// Same for NED -> geodetic through the reference EcefToGeo (bit-identical to NedToGeo)
+template <typename TLoad, typename TStore>
+void NedToGeoChunked(const SLocalFrame& frame, uint32_t pointCount, TLoad load, TStore store) {
+    SPointECEF ecefChunk[BATCH_CHUNK_SIZE];
+    SPointGeo geoChunk[BATCH_CHUNK_SIZE];
+    for (uint32_t base = 0; base < pointCount; base += BATCH_CHUNK_SIZE) {
+        const uint32_t chunkCount = MIN(pointCount - base, BATCH_CHUNK_SIZE);
+        for (uint32_t k = 0; k < chunkCount; ++k) {
+            ecefChunk[k] = NedToEcef(frame, load(base + k));
+        }
+
+        EcefToGeoDispatch(ECoordsKernel::KERNEL_REFERENCE, ecefChunk, chunkCount, geoChunk);
+
+        for (uint32_t k = 0; k < chunkCount; ++k) {
+            store(base + k, geoChunk[k]);
+        }
+    }
+}
+
+// Element i of a strided column
+template <typename T>
+inline T& ColumnAt(T* column, size_t strideBytes, uint32_t i) {
+    return *reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(column) + (size_t)i * strideBytes);
+}
+
+// A nonzero stride shorter than the record would make consecutive records overlap; 0 means packed
+inline bool IsStrideTooSmall(uint32_t strideBytes, size_t recordBytes) {
+    return strideBytes != 0 && strideBytes < recordBytes;
+}
+
+} // namespace
+
+// --- Parallel batch jobs ---
+
+namespace {
+
+// Keeps nullptr as is, so every worker reports the same validation error as the serial call
+template <typename T>
+inline T* OffsetBytes(T* base, size_t bytes) {
+    return (base == nullptr) ? nullptr : reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(base) + bytes);
+}
+
+// First failing worker in worker order, so the state does not depend on timing
+EResultState CombineWorkerStates(const uint8_t* states, uint32_t workerCount) {
+    for (uint32_t w = 0; w < workerCount; ++w) {
+        if (states[w] != EResultState::OK) return (EResultState)states[w];
+    }
+    return EResultState::OK;
+}
+
+template <typename TIn, typename TOut>
+struct SConvertJob {
+    void (*convert)(double, double, double, const TIn*, uint32_t, uint32_t, TOut*, uint32_t, uint8_t*);
+    double originLatitudeDeg;
+    double originLongitudeDeg;
+    double originAltitude;
+    const TIn* inPoints;
+    uint32_t pointCount;
+    uint32_t inStrideBytes;
+    TOut* outPoints;
+    uint32_t outStrideBytes;
+    uint8_t states[WORKER_POOL_MAX_THREADS];
+};
+
+template <typename TIn, typename TOut>
+void ConvertJobBody(void* context, uint32_t worker, uint32_t workerCount) {
+    SConvertJob<TIn, TOut>& job = *static_cast<SConvertJob<TIn, TOut>*>(context);
+    uint32_t begin, end;
+    PartitionRange(job.pointCount, BATCH_CHUNK_SIZE, worker, workerCount, &begin, &end);
+
+    job.states[worker] = EResultState::OK;
+    if (begin == end && worker > 0) {
+        return;
+    }
+
+    const size_t inStride = (job.inStrideBytes == 0) ? sizeof(TIn) : job.inStrideBytes;
+    const size_t outStride = (job.outStrideBytes == 0) ? sizeof(TOut) : job.outStrideBytes;
+    job.convert(job.originLatitudeDeg, job.originLongitudeDeg, job.originAltitude,
+        OffsetBytes(job.inPoints, begin * inStride), end - begin, job.inStrideBytes,
+        OffsetBytes(job.outPoints, begin * outStride), job.outStrideBytes, &job.states[worker]);
+}
+
+template <typename TIn, typename TOut>
+void RunConvertJob(uint8_t* pool, SConvertJob<TIn, TOut>& job, uint8_t* resultState) {
+    const uint32_t workerCount = WorkerPoolThreadCount(pool);
+    if (workerCount == 0) {
+        *resultState = (pool == nullptr) ? EResultState::BUFFER_IS_NULL_PTR : EResultState::PREPARED_DATA_INVALID;
+        return;
+    }
+
+    RunOnWorkerPool(pool, ConvertJobBody<TIn, TOut>, &job);
+    *resultState = CombineWorkerStates(job.states, workerCount);
+}
+
+struct SInsideBatchJob {
+    const SPointNE* polygon;
+    uint16_t pointCount;
+    const SPointNE* testPoints;
+    uint32_t testPointCount;
+    const float* radiiMeters;
+    float radiusMeters;
+    uint8_t* outResults;
+    uint8_t states[WORKER_POOL_MAX_THREADS];
+};
+
+void InsideBatchJobBody(void* context, uint32_t worker, uint32_t workerCount) {
+    SInsideBatchJob& job = *static_cast<SInsideBatchJob*>(context);
+    uint32_t begin, end;
+    PartitionRange(job.testPointCount, POLYGON_BATCH_BLOCK, worker, workerCount, &begin, &end);
+
+    job.states[worker] = EResultState::OK;
+    if (begin == end && worker > 0) {
+        return;
+    }
+
+    isInsidePolygonBatch(job.polygon, job.pointCount, OffsetBytes(job.testPoints, begin * sizeof(SPointNE)), end - begin,
+        OffsetBytes(job.radiiMeters, begin * sizeof(float)), job.radiusMeters, OffsetBytes(job.outResults, begin), &job.states[worker]);
+}
+
+} // namespace
+
 // --- Main API Functions ---
 
 void isInsidePolygon(const SPointNE* polygon, uint16_t pointCount, const SPointNE testPoint, float radiusMeters, uint8_t* outResult, uint8_t* resultState) {
-    #if defined(_DEBUG) || !defined(NDEBUG)
+    API_TIMER(EApiTimerID::TimerIsInsidePolygon);
+
+    #if defined(API_FUNCTIONS_INSTRUMENTED)
         const ECovFuncID current_func_id = ECovFuncID::IsInside;
     #endif
     
@@ -53,20 +254,11 @@ void isInsidePolygon(const SPointNE* polygon, uint16_t pointCount, const SPointN
     for (size_t i = 0, j = pointCount - 1; i < pointCount; j = i++) {
         COV_POINT(3);
         // Check if edge straddles the test point's East line
-        if ((polygon[i].east > testPoint.east) != (polygon[j].east > testPoint.east)) {
+        if (doesEdgeStraddleEast(polygon[i], polygon[j], testPoint)) {
             COV_POINT(4);
 
-            // for safety of dividing by zero
-            float deltaEast = polygon[j].east - polygon[i].east;
-            if (std::abs(deltaEast) < EPSILON) {
-                continue;
-            }
-            // Calculate intersection on North axis 
-            // y = y_1 + m*(x-x_1)
-            double intersectN = polygon[i].north + ((polygon[j].north - polygon[i].north) / deltaEast) * (testPoint.east - polygon[i].east);
-
             // Toggle state if intersection is strictly to the North of test point
-            if (testPoint.north < intersectN) {
+            if (doesRayCrossEdgeNorth(polygon[i], polygon[j], testPoint)) {
                 COV_POINT(5);
                 isCenterInside = !isCenterInside;
             }
@@ -87,14 +279,14 @@ void isInsidePolygon(const SPointNE* polygon, uint16_t pointCount, const SPointN
         double dSq = getDistToSegmentSquared(testPoint, polygon[i], polygon[(i + 1) % pointCount]);
 
         // If distance is less than radius, the object hits the wall.
-        if (dSq < radiusMeters * radiusMeters && !areAlmostEqual(dSq, radiusMeters * radiusMeters)) {
+        if (isWithinRadius(dSq, radiusMeters)) {
             COV_POINT(8);
             *outResult = true;
             return;
         }
 
         // Check if point is exactly on the boundary
-        if (areAlmostEqual(dSq, 0.0)) {
+        if (isOnBoundary(dSq)) {
             COV_POINT(9);
             *outResult = true;
             return;
@@ -108,7 +300,9 @@ void isInsidePolygon(const SPointNE* polygon, uint16_t pointCount, const SPointN
 
 
 void doesLineIntersectPolygon(const SPointNE* polygon, uint16_t pointCount, const SPointNE testPoint, float azimuthDegrees, float maxLength, uint8_t* outResult, uint8_t* resultState) {
-    #if defined(_DEBUG) || !defined(NDEBUG)
+    API_TIMER(EApiTimerID::TimerDoesLineIntersectPolygon);
+
+    #if defined(API_FUNCTIONS_INSTRUMENTED)
         const ECovFuncID current_func_id = ECovFuncID::Intersect;
     #endif
     
@@ -146,11 +340,7 @@ void doesLineIntersectPolygon(const SPointNE* polygon, uint16_t pointCount, cons
     }
 
     // Calculate End Point of the Line
-    // NED System: Azimuth 0 is North (+X), 90 is East (+Y).
-    double thetaRad = azimuthDegrees * (PI / 180.0);
-    SPointNE endPoint;
-    endPoint.north = testPoint.north + maxLength * std::cos(thetaRad);
-    endPoint.east = testPoint.east + maxLength * std::sin(thetaRad);
+    const SPointNE endPoint = GetRayEndPoint(SRayNE{ testPoint, azimuthDegrees, maxLength });
 
     // Check Intersection with all Polygon Edges
     for (size_t i = 0; i < pointCount; ++i) {
@@ -172,6 +362,8 @@ void doesLineIntersectPolygon(const SPointNE* polygon, uint16_t pointCount, cons
 
 void GeoToNed(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const SPointGeo geoPoint, SPointNED* resNedPoint)
 {
+    API_TIMER(EApiTimerID::TimerGeoToNed);
+
     SPointECEF pointEcef = GeoToEcef(geoPoint);
     SPointNED pointNed = EcefToNed(originLatitudeDeg, originLongitudeDeg, originAltitude, pointEcef);
 
@@ -181,8 +373,1124 @@ void GeoToNed(const double originLatitudeDeg, const double originLongitudeDeg, c
 
 void NedToGeo(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const SPointNED nedPoint, SPointGeo* resGeopoint)
 {
+    API_TIMER(EApiTimerID::TimerNedToGeo);
+
     SPointECEF pointEcef = NedToEcef(originLatitudeDeg, originLongitudeDeg, originAltitude, nedPoint);
     SPointGeo pointGeo = EcefToGeo(pointEcef);
 
     *resGeopoint = pointGeo;
-}
\ No newline at end of file
+}
+
+
+void GeoToNedBatch(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const SPointGeo* geoPoints, uint32_t pointCount, uint32_t inStrideBytes, SPointNED* resNedPoints, uint32_t outStrideBytes, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerGeoToNedBatch);
+
+    *resultState = EResultState::OK;
+
+    if (geoPoints == nullptr || resNedPoints == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    if (IsStrideTooSmall(inStrideBytes, sizeof(SPointGeo)) || IsStrideTooSmall(outStrideBytes, sizeof(SPointNED))) {
+        *resultState = EResultState::STRIDE_TOO_SMALL;
+        return;
+    }
+
+    const size_t inStride = (inStrideBytes == 0) ? sizeof(SPointGeo) : inStrideBytes;
+    const size_t outStride = (outStrideBytes == 0) ? sizeof(SPointNED) : outStrideBytes;
+
+    // Origin frame is computed once for the whole batch
+    const SLocalFrame frame = ComputeLocalFrame(originLatitudeDeg, originLongitudeDeg, originAltitude);
+
+    const uint8_t* inBytes = reinterpret_cast<const uint8_t*>(geoPoints);
+    uint8_t* outBytes = reinterpret_cast<uint8_t*>(resNedPoints);
+
+    // Points are streamed in fixed-size chunks through the reference conversions
+    GeoToNedChunked(frame, pointCount,
+        [inBytes, inStride](uint32_t i) { return *reinterpret_cast<const SPointGeo*>(inBytes + (size_t)i * inStride); },
+        [outBytes, outStride](uint32_t i, const SPointNED& ned) { *reinterpret_cast<SPointNED*>(outBytes + (size_t)i * outStride) = ned; });
+}
+
+
+void NedToGeoBatch(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const SPointNED* nedPoints, uint32_t pointCount, uint32_t inStrideBytes, SPointGeo* resGeoPoints, uint32_t outStrideBytes, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerNedToGeoBatch);
+
+    *resultState = EResultState::OK;
+
+    if (nedPoints == nullptr || resGeoPoints == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    if (IsStrideTooSmall(inStrideBytes, sizeof(SPointNED)) || IsStrideTooSmall(outStrideBytes, sizeof(SPointGeo))) {
+        *resultState = EResultState::STRIDE_TOO_SMALL;
+        return;
+    }
+
+    const size_t inStride = (inStrideBytes == 0) ? sizeof(SPointNED) : inStrideBytes;
+    const size_t outStride = (outStrideBytes == 0) ? sizeof(SPointGeo) : outStrideBytes;
+
+    // Origin frame is computed once for the whole batch
+    const SLocalFrame frame = ComputeLocalFrame(originLatitudeDeg, originLongitudeDeg, originAltitude);
+
+    const uint8_t* inBytes = reinterpret_cast<const uint8_t*>(nedPoints);
+    uint8_t* outBytes = reinterpret_cast<uint8_t*>(resGeoPoints);
+
+    // Points are streamed in fixed-size chunks through the reference conversions
+    NedToGeoChunked(frame, pointCount,
+        [inBytes, inStride](uint32_t i) { return *reinterpret_cast<const SPointNED*>(inBytes + (size_t)i * inStride); },
+        [outBytes, outStride](uint32_t i, const SPointGeo& geo) { *reinterpret_cast<SPointGeo*>(outBytes + (size_t)i * outStride) = geo; });
+}
+
+
+void GeoToNedColumns(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const double* latitudeDeg, const double* longitudeDeg, const double* altitude, uint32_t pointCount, uint32_t inStrideBytes, double* north, double* east, double* down, uint32_t outStrideBytes, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (latitudeDeg == nullptr || longitudeDeg == nullptr || altitude == nullptr || north == nullptr || east == nullptr || down == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    if (IsStrideTooSmall(inStrideBytes, sizeof(double)) || IsStrideTooSmall(outStrideBytes, sizeof(double))) {
+        *resultState = EResultState::STRIDE_TOO_SMALL;
+        return;
+    }
+
+    const size_t inStride = (inStrideBytes == 0) ? sizeof(double) : inStrideBytes;
+    const size_t outStride = (outStrideBytes == 0) ? sizeof(double) : outStrideBytes;
+
+    const SLocalFrame frame = ComputeLocalFrame(originLatitudeDeg, originLongitudeDeg, originAltitude);
+
+    GeoToNedChunked(frame, pointCount,
+        [=](uint32_t i) { return SPointGeo{ ColumnAt(latitudeDeg, inStride, i), ColumnAt(longitudeDeg, inStride, i), ColumnAt(altitude, inStride, i) }; },
+        [=](uint32_t i, const SPointNED& ned) {
+            ColumnAt(north, outStride, i) = ned.north;
+            ColumnAt(east, outStride, i) = ned.east;
+            ColumnAt(down, outStride, i) = ned.down;
+        });
+}
+
+
+void NedToGeoColumns(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const double* north, const double* east, const double* down, uint32_t pointCount, uint32_t inStrideBytes, double* latitudeDeg, double* longitudeDeg, double* altitude, uint32_t outStrideBytes, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (north == nullptr || east == nullptr || down == nullptr || latitudeDeg == nullptr || longitudeDeg == nullptr || altitude == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    if (IsStrideTooSmall(inStrideBytes, sizeof(double)) || IsStrideTooSmall(outStrideBytes, sizeof(double))) {
+        *resultState = EResultState::STRIDE_TOO_SMALL;
+        return;
+    }
+
+    const size_t inStride = (inStrideBytes == 0) ? sizeof(double) : inStrideBytes;
+    const size_t outStride = (outStrideBytes == 0) ? sizeof(double) : outStrideBytes;
+
+    const SLocalFrame frame = ComputeLocalFrame(originLatitudeDeg, originLongitudeDeg, originAltitude);
+
+    NedToGeoChunked(frame, pointCount,
+        [=](uint32_t i) { return SPointNED{ ColumnAt(north, inStride, i), ColumnAt(east, inStride, i), ColumnAt(down, inStride, i) }; },
+        [=](uint32_t i, const SPointGeo& geo) {
+            ColumnAt(latitudeDeg, outStride, i) = geo.latitudeDeg;
+            ColumnAt(longitudeDeg, outStride, i) = geo.longitudeDeg;
+            ColumnAt(altitude, outStride, i) = geo.altitude;
+        });
+}
+
+
+void InitLocalSeriesFrame(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, SLocalSeriesFrame* frame)
+{
+    if (frame == nullptr) {
+        return;
+    }
+    *frame = ComputeLocalSeriesFrame(originLatitudeDeg, originLongitudeDeg, originAltitude);
+}
+
+
+void GeoToNedSeriesBatch(const SLocalSeriesFrame* frame, const SPointGeo* geoPoints, uint32_t pointCount, uint32_t inStrideBytes, SPointNED* resNedPoints, uint32_t outStrideBytes, double* outMaxErrorMeters, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (frame == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (geoPoints == nullptr || resNedPoints == nullptr || outMaxErrorMeters == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    if (IsStrideTooSmall(inStrideBytes, sizeof(SPointGeo)) || IsStrideTooSmall(outStrideBytes, sizeof(SPointNED))) {
+        *resultState = EResultState::STRIDE_TOO_SMALL;
+        return;
+    }
+
+    const size_t inStride = (inStrideBytes == 0) ? sizeof(SPointGeo) : inStrideBytes;
+    const size_t outStride = (outStrideBytes == 0) ? sizeof(SPointNED) : outStrideBytes;
+    const uint8_t* inBytes = reinterpret_cast<const uint8_t*>(geoPoints);
+    uint8_t* outBytes = reinterpret_cast<uint8_t*>(resNedPoints);
+
+    double maxError = 0.0;
+    for (uint32_t i = 0; i < pointCount; ++i) {
+        double errorBound;
+        *reinterpret_cast<SPointNED*>(outBytes + (size_t)i * outStride) =
+            GeoToNedSeries(*frame, *reinterpret_cast<const SPointGeo*>(inBytes + (size_t)i * inStride), &errorBound);
+        maxError = MAX(maxError, errorBound);
+    }
+    *outMaxErrorMeters = maxError;
+}
+
+
+void NedToGeoSeriesBatch(const SLocalSeriesFrame* frame, const SPointNED* nedPoints, uint32_t pointCount, uint32_t inStrideBytes, SPointGeo* resGeoPoints, uint32_t outStrideBytes, double* outMaxErrorMeters, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (frame == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (nedPoints == nullptr || resGeoPoints == nullptr || outMaxErrorMeters == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    if (IsStrideTooSmall(inStrideBytes, sizeof(SPointNED)) || IsStrideTooSmall(outStrideBytes, sizeof(SPointGeo))) {
+        *resultState = EResultState::STRIDE_TOO_SMALL;
+        return;
+    }
+
+    const size_t inStride = (inStrideBytes == 0) ? sizeof(SPointNED) : inStrideBytes;
+    const size_t outStride = (outStrideBytes == 0) ? sizeof(SPointGeo) : outStrideBytes;
+    const uint8_t* inBytes = reinterpret_cast<const uint8_t*>(nedPoints);
+    uint8_t* outBytes = reinterpret_cast<uint8_t*>(resGeoPoints);
+
+    double maxError = 0.0;
+    for (uint32_t i = 0; i < pointCount; ++i) {
+        double errorBound;
+        *reinterpret_cast<SPointGeo*>(outBytes + (size_t)i * outStride) =
+            NedToGeoSeries(*frame, *reinterpret_cast<const SPointNED*>(inBytes + (size_t)i * inStride), &errorBound);
+        maxError = MAX(maxError, errorBound);
+    }
+    *outMaxErrorMeters = maxError;
+}
+
+
+void GetLocalSeriesErrorBound(const SLocalSeriesFrame* frame, double horizontalDistanceMeters, double altitudeDeltaMeters, double* outErrorMeters)
+{
+    if (outErrorMeters == nullptr) {
+        return;
+    }
+    *outErrorMeters = (frame == nullptr) ? INFINITY : GetSeriesErrorBound(*frame, horizontalDistanceMeters, altitudeDeltaMeters);
+}
+
+
+void InitLocalFrame(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, SLocalFrame* frame, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (frame == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    *frame = ComputeLocalFrame(originLatitudeDeg, originLongitudeDeg, originAltitude);
+}
+
+
+void GeoToNedFrame(const SLocalFrame* frame, const SPointGeo geoPoint, SPointNED* resNedPoint, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (frame == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (resNedPoint == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    *resNedPoint = EcefToNed(*frame, GeoToEcef(geoPoint));
+}
+
+
+void NedToGeoFrame(const SLocalFrame* frame, const SPointNED nedPoint, SPointGeo* resGeoPoint, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (frame == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (resGeoPoint == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    *resGeoPoint = EcefToGeo(NedToEcef(*frame, nedPoint));
+}
+
+
+void EcefToNedFrame(const SLocalFrame* frame, const SPointECEF ecefPoint, SPointNED* resNedPoint, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (frame == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (resNedPoint == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    *resNedPoint = EcefToNed(*frame, ecefPoint);
+}
+
+
+void GeoToEcefArray(const SPointGeo* geoPoints, uint32_t pointCount, SPointECEF* resEcefPoints, uint8_t kernel, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (geoPoints == nullptr || resEcefPoints == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+    if (!IsCoordsKernelSupported((ECoordsKernel)kernel)) {
+        *resultState = EResultState::KERNEL_NOT_SUPPORTED;
+        return;
+    }
+
+    GeoToEcefDispatch((ECoordsKernel)kernel, geoPoints, pointCount, resEcefPoints);
+}
+
+
+void EcefToGeoArray(const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints, uint8_t kernel, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (ecefPoints == nullptr || resGeoPoints == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+    if (!IsCoordsKernelSupported((ECoordsKernel)kernel)) {
+        *resultState = EResultState::KERNEL_NOT_SUPPORTED;
+        return;
+    }
+
+    EcefToGeoDispatch((ECoordsKernel)kernel, ecefPoints, pointCount, resGeoPoints);
+}
+
+
+void EcefToGeoArrayMethod(const SPointECEF* ecefPoints, uint32_t pointCount, SPointGeo* resGeoPoints, uint8_t method, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (ecefPoints == nullptr || resGeoPoints == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+    if (method > EEcefToGeoMethod::ECEF_TO_GEO_OLSON) {
+        *resultState = EResultState::METHOD_NOT_SUPPORTED;
+        return;
+    }
+
+    for (uint32_t i = 0; i < pointCount; ++i) {
+        resGeoPoints[i] = EcefToGeo(ecefPoints[i], (EEcefToGeoMethod)method);
+    }
+}
+
+
+void NedToGeoFrameMethod(const SLocalFrame* frame, const SPointNED nedPoint, uint8_t method, SPointGeo* resGeoPoint, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (frame == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (resGeoPoint == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+    if (method > EEcefToGeoMethod::ECEF_TO_GEO_OLSON) {
+        *resultState = EResultState::METHOD_NOT_SUPPORTED;
+        return;
+    }
+
+    *resGeoPoint = EcefToGeo(NedToEcef(*frame, nedPoint), (EEcefToGeoMethod)method);
+}
+
+
+void GetActiveCoordsKernel(uint8_t* outKernel)
+{
+    *outKernel = GetBestCoordsKernel();
+}
+
+
+void GetPreparedPolygonSize(const SPointNE* polygon, uint16_t pointCount, uint32_t* outSizeBytes, uint8_t* resultState)
+{
+    *resultState = GetPolygonIndexSize(polygon, pointCount, outSizeBytes);
+}
+
+
+void PreparePolygon(const SPointNE* polygon, uint16_t pointCount, uint8_t* buffer, uint32_t bufferSize, uint8_t* resultState)
+{
+    *resultState = PreparePolygonIndex(polygon, pointCount, buffer, bufferSize);
+}
+
+
+void isInsidePolygonPrepared(const uint8_t* prepared, const SPointNE testPoint, float radiusMeters, uint8_t* outResult, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerIsInsidePolygonPrepared);
+
+    *outResult = true;
+
+    EResultState state;
+    const SPolygonIndexHeader* index = GetPolygonIndexHeader(prepared, &state);
+    *resultState = state;
+    if (index == nullptr) {
+        return;
+    }
+
+    *outResult = IsInsidePolygonIndexed(index, testPoint, radiusMeters);
+}
+
+
+void isInsidePolygonBatch(const SPointNE* polygon, uint16_t pointCount, const SPointNE* testPoints, uint32_t testPointCount, const float* radiiMeters, float radiusMeters, uint8_t* outResults, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerIsInsidePolygonBatch);
+
+    if (outResults == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    *resultState = IsInsidePolygonBatchRun(polygon, pointCount, testPoints, testPointCount, radiiMeters, radiusMeters,
+        [outResults](uint32_t base, uint32_t count, uint64_t mask) {
+            for (uint32_t k = 0; k < count; ++k) {
+                outResults[base + k] = (uint8_t)((mask >> k) & 1);
+            }
+        });
+}
+
+
+void isInsidePolygonBatchBits(const SPointNE* polygon, uint16_t pointCount, const SPointNE* testPoints, uint32_t testPointCount, const float* radiiMeters, float radiusMeters, uint8_t* outBits, uint8_t* resultState)
+{
+    if (outBits == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    // Blocks are 64 points, so every block starts on a byte boundary
+    *resultState = IsInsidePolygonBatchRun(polygon, pointCount, testPoints, testPointCount, radiiMeters, radiusMeters,
+        [outBits](uint32_t base, uint32_t count, uint64_t mask) {
+            for (uint32_t byte = 0; byte * 8 < count; ++byte) {
+                outBits[base / 8 + byte] = (uint8_t)(mask >> (byte * 8));
+            }
+        });
+}
+
+
+void isInsidePolygonColumns(const SPointNE* polygon, uint16_t pointCount, const double* testNorth, const double* testEast, uint32_t testPointCount, uint32_t inStrideBytes, float radiusMeters, uint8_t* outResults, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (testNorth == nullptr || testEast == nullptr || outResults == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    if (IsStrideTooSmall(inStrideBytes, sizeof(double))) {
+        *resultState = EResultState::STRIDE_TOO_SMALL;
+        return;
+    }
+
+    const size_t inStride = (inStrideBytes == 0) ? sizeof(double) : inStrideBytes;
+
+    // Each block is gathered into SPointNE (narrowed to float) and walked edge-major
+    SPointNE block[POLYGON_BATCH_BLOCK];
+    for (uint32_t base = 0; base < testPointCount; base += POLYGON_BATCH_BLOCK) {
+        const uint32_t blockCount = MIN(testPointCount - base, POLYGON_BATCH_BLOCK);
+        for (uint32_t k = 0; k < blockCount; ++k) {
+            block[k] = SPointNE{ (float)ColumnAt(testNorth, inStride, base + k), (float)ColumnAt(testEast, inStride, base + k) };
+        }
+
+        const uint64_t mask = IsInsidePolygonBlock(polygon, pointCount, block, blockCount, nullptr, radiusMeters);
+        for (uint32_t k = 0; k < blockCount; ++k) {
+            outResults[base + k] = (uint8_t)((mask >> k) & 1);
+        }
+    }
+}
+
+
+void doesLineIntersectPolygonColumns(const SPointNE* polygon, uint16_t pointCount, const double* startNorth, const double* startEast, const double* azimuthDegrees, const double* maxLengthMeters, uint32_t lineCount, uint32_t inStrideBytes, uint8_t* outResults, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (startNorth == nullptr || startEast == nullptr || azimuthDegrees == nullptr || maxLengthMeters == nullptr || outResults == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    if (IsStrideTooSmall(inStrideBytes, sizeof(double))) {
+        *resultState = EResultState::STRIDE_TOO_SMALL;
+        return;
+    }
+
+    const size_t inStride = (inStrideBytes == 0) ? sizeof(double) : inStrideBytes;
+
+    // Lines with a non-positive length get true and set the aggregate state, the others still run
+    for (uint32_t i = 0; i < lineCount; ++i) {
+        const SPointNE start = { (float)ColumnAt(startNorth, inStride, i), (float)ColumnAt(startEast, inStride, i) };
+        uint8_t state = EResultState::OK;
+        doesLineIntersectPolygon(polygon, pointCount, start, (float)ColumnAt(azimuthDegrees, inStride, i),
+            (float)ColumnAt(maxLengthMeters, inStride, i), &outResults[i], &state);
+        if (state != EResultState::OK) {
+            *resultState = state;
+        }
+    }
+}
+
+
+void GetPreparedZonesSize(const uint16_t* zonePointCounts, uint32_t zoneCount, uint32_t* outSizeBytes, uint8_t* resultState)
+{
+    *resultState = GetZoneIndexSize(zonePointCounts, zoneCount, outSizeBytes);
+}
+
+
+void PrepareZones(const SPointNE* zonePoints, const uint16_t* zonePointCounts, const uint32_t* zoneIds, uint32_t zoneCount, uint8_t* buffer, uint32_t bufferSize, uint8_t* resultState)
+{
+    *resultState = PrepareZoneIndex(zonePoints, zonePointCounts, zoneIds, zoneCount, buffer, bufferSize);
+}
+
+
+void QueryZonesCircle(const uint8_t* preparedZones, const SPointNE testPoint, float radiusMeters, uint32_t* outZoneIds, uint32_t maxZoneIds, uint32_t* outCount, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerQueryZonesCircle);
+
+    *outCount = 0;
+
+    EResultState state;
+    const SZoneIndexHeader* index = GetZoneIndexHeader(preparedZones, &state);
+    *resultState = state;
+    if (index == nullptr) {
+        return;
+    }
+    if (outZoneIds == nullptr && maxZoneIds > 0) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    *outCount = QueryZonesCircleIndexed(index, testPoint, radiusMeters, outZoneIds, maxZoneIds);
+    if (*outCount > maxZoneIds) {
+        *resultState = EResultState::OUTPUT_TOO_SMALL;
+    }
+}
+
+
+void QueryZonesSegment(const uint8_t* preparedZones, const SPointNE testPoint, float azimuthDegrees, float maxLength, uint32_t* outZoneIds, uint32_t maxZoneIds, uint32_t* outCount, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerQueryZonesSegment);
+
+    *outCount = 0;
+
+    EResultState state;
+    const SZoneIndexHeader* index = GetZoneIndexHeader(preparedZones, &state);
+    *resultState = state;
+    if (index == nullptr) {
+        return;
+    }
+    if (outZoneIds == nullptr && maxZoneIds > 0) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (maxLength <= 0.0f) {
+        *resultState = EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO;
+        return;
+    }
+
+    *outCount = QueryZonesSegmentIndexed(index, testPoint, azimuthDegrees, maxLength, outZoneIds, maxZoneIds);
+    if (*outCount > maxZoneIds) {
+        *resultState = EResultState::OUTPUT_TOO_SMALL;
+    }
+}
+
+
+void getFirstRayHit(const SPointNE* polygon, uint16_t pointCount, const SRayNE ray, SRayHit* outHit, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerGetFirstRayHit);
+
+    // Fail safe: report an immediate hit until the query succeeds
+    *outHit = SRayHit{ true, RAY_START_INSIDE, 0.0f, ray.startPoint };
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (ray.maxLength <= 0.0f) {
+        *resultState = EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO;
+        return;
+    }
+
+    *outHit = CastRayPolygon(polygon, pointCount, ray);
+}
+
+
+void getFirstRayHitBatch(const SPointNE* polygon, uint16_t pointCount, const SRayNE* rays, uint32_t rayCount, SRayHit* outHits, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (rays == nullptr || outHits == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+
+    for (uint32_t i = 0; i < rayCount; ++i) {
+        if (rays[i].maxLength <= 0.0f) {
+            outHits[i] = SRayHit{ true, RAY_START_INSIDE, 0.0f, rays[i].startPoint };
+            *resultState = EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO;
+            continue;
+        }
+        outHits[i] = CastRayPolygon(polygon, pointCount, rays[i]);
+    }
+}
+
+
+void getFirstRayHitPrepared(const uint8_t* prepared, const SRayNE ray, SRayHit* outHit, uint8_t* resultState)
+{
+    *outHit = SRayHit{ true, RAY_START_INSIDE, 0.0f, ray.startPoint };
+
+    EResultState state;
+    const SPolygonIndexHeader* index = GetPolygonIndexHeader(prepared, &state);
+    *resultState = state;
+    if (index == nullptr) {
+        return;
+    }
+    if (ray.maxLength <= 0.0f) {
+        *resultState = EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO;
+        return;
+    }
+
+    *outHit = CastRayIndexed(index, ray);
+}
+
+
+void getPolygonClearance(const SPointNE* polygon, uint16_t pointCount, const SPointNE testPoint, float radiusMeters, SPolygonClearance* outClearance, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerGetPolygonClearance);
+
+    *outClearance = SPolygonClearance{ true, 0, 0.0f, 0.0f };
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+
+    *outClearance = ComputePolygonClearance(polygon, pointCount, testPoint, radiusMeters);
+}
+
+
+void InitPolygonBounds(const SPointNE* polygon, uint16_t pointCount, SPolygonBounds* outBounds, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (outBounds == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    *outBounds = ComputePolygonBounds(polygon, pointCount);
+}
+
+
+void isInsidePolygonBounded(const SPointNE* polygon, uint16_t pointCount, const SPolygonBounds* bounds, const SPointNE testPoint, float radiusMeters, uint8_t* outResult, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerIsInsidePolygonBounded);
+
+    *outResult = true;
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (bounds == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (bounds->pointCount != pointCount) {
+        *resultState = EResultState::PREPARED_DATA_INVALID;
+        return;
+    }
+
+    REJECT_COUNT(ERejectCounterID::InsideQueries);
+    switch (CheckCircleAgainstBounds(*bounds, testPoint, radiusMeters)) {
+    case EBoundsReject::REJECT_BY_BOX:
+        REJECT_COUNT(ERejectCounterID::InsideBoxRejects);
+        *outResult = false;
+        return;
+    case EBoundsReject::REJECT_BY_CIRCLE:
+        REJECT_COUNT(ERejectCounterID::InsideCircleRejects);
+        *outResult = false;
+        return;
+    default:
+        break;
+    }
+
+    isInsidePolygon(polygon, pointCount, testPoint, radiusMeters, outResult, resultState);
+}
+
+
+void doesLineIntersectPolygonBounded(const SPointNE* polygon, uint16_t pointCount, const SPolygonBounds* bounds, const SPointNE testPoint, float azimuthDegrees, float maxLength, uint8_t* outResult, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerDoesLineIntersectPolygonBounded);
+
+    *outResult = true;
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (maxLength <= 0.0f) {
+        *resultState = EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO;
+        return;
+    }
+    if (bounds == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (bounds->pointCount != pointCount) {
+        *resultState = EResultState::PREPARED_DATA_INVALID;
+        return;
+    }
+
+    REJECT_COUNT(ERejectCounterID::IntersectQueries);
+    const SRayNE ray = { testPoint, azimuthDegrees, maxLength };
+    switch (CheckSegmentAgainstBounds(*bounds, testPoint, GetRayEndPoint(ray))) {
+    case EBoundsReject::REJECT_BY_BOX:
+        REJECT_COUNT(ERejectCounterID::IntersectBoxRejects);
+        *outResult = false;
+        return;
+    case EBoundsReject::REJECT_BY_CIRCLE:
+        REJECT_COUNT(ERejectCounterID::IntersectCircleRejects);
+        *outResult = false;
+        return;
+    default:
+        break;
+    }
+
+    doesLineIntersectPolygon(polygon, pointCount, testPoint, azimuthDegrees, maxLength, outResult, resultState);
+}
+
+
+void ArenaInit(SArena* arena, uint8_t* buffer, uint32_t bufferSize, uint8_t* resultState)
+{
+    if (arena == nullptr || buffer == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    *resultState = InitArena(*arena, buffer, bufferSize);
+}
+
+
+void ArenaAlloc(SArena* arena, uint32_t sizeBytes, uint32_t alignment, uint8_t** outPtr, uint8_t* resultState)
+{
+    if (outPtr == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+    *outPtr = nullptr;
+    if (arena == nullptr || arena->base == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    EResultState state;
+    *outPtr = ArenaPushArray<uint8_t>(*arena, sizeBytes, &state, alignment);
+    *resultState = state;
+}
+
+
+void ArenaMark(const SArena* arena, uint32_t* outMark, uint8_t* resultState)
+{
+    if (arena == nullptr || outMark == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    *outMark = arena->used;
+    *resultState = EResultState::OK;
+}
+
+
+void ArenaRewind(SArena* arena, uint32_t mark, uint8_t* resultState)
+{
+    if (arena == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    *resultState = ArenaRewindTo(*arena, mark);
+}
+
+
+void ArenaHighWater(const SArena* arena, uint32_t* outBytes, uint8_t* resultState)
+{
+    if (arena == nullptr || outBytes == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    *outBytes = arena->highWater;
+    *resultState = EResultState::OK;
+}
+
+
+void GetWorkerPoolSize(uint32_t* outSizeBytes, uint8_t* resultState)
+{
+    if (outSizeBytes == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    *outSizeBytes = WorkerPoolSize();
+    *resultState = EResultState::OK;
+}
+
+
+void WorkerPoolInit(uint8_t* buffer, uint32_t bufferSize, uint32_t threadCount, uint8_t* resultState)
+{
+    *resultState = InitWorkerPool(buffer, bufferSize, threadCount);
+}
+
+
+void WorkerPoolShutdown(uint8_t* pool, uint8_t* resultState)
+{
+    *resultState = ShutdownWorkerPool(pool);
+}
+
+
+void GeoToNedBatchParallel(uint8_t* pool, const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const SPointGeo* geoPoints, uint32_t pointCount, uint32_t inStrideBytes, SPointNED* resNedPoints, uint32_t outStrideBytes, uint8_t* resultState)
+{
+    SConvertJob<SPointGeo, SPointNED> job = { GeoToNedBatch, originLatitudeDeg, originLongitudeDeg, originAltitude,
+        geoPoints, pointCount, inStrideBytes, resNedPoints, outStrideBytes, {} };
+    RunConvertJob(pool, job, resultState);
+}
+
+
+void NedToGeoBatchParallel(uint8_t* pool, const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const SPointNED* nedPoints, uint32_t pointCount, uint32_t inStrideBytes, SPointGeo* resGeoPoints, uint32_t outStrideBytes, uint8_t* resultState)
+{
+    SConvertJob<SPointNED, SPointGeo> job = { NedToGeoBatch, originLatitudeDeg, originLongitudeDeg, originAltitude,
+        nedPoints, pointCount, inStrideBytes, resGeoPoints, outStrideBytes, {} };
+    RunConvertJob(pool, job, resultState);
+}
+
+
+void isInsidePolygonBatchParallel(uint8_t* pool, const SPointNE* polygon, uint16_t pointCount, const SPointNE* testPoints, uint32_t testPointCount, const float* radiiMeters, float radiusMeters, uint8_t* outResults, uint8_t* resultState)
+{
+    const uint32_t workerCount = WorkerPoolThreadCount(pool);
+    if (workerCount == 0) {
+        *resultState = (pool == nullptr) ? EResultState::BUFFER_IS_NULL_PTR : EResultState::PREPARED_DATA_INVALID;
+        return;
+    }
+
+    SInsideBatchJob job = { polygon, pointCount, testPoints, testPointCount, radiiMeters, radiusMeters, outResults, {} };
+    RunOnWorkerPool(pool, InsideBatchJobBody, &job);
+    *resultState = CombineWorkerStates(job.states, workerCount);
+}
+
+
+void doesRouteIntersectPolygon(const SPointNE* polygon, uint16_t pointCount, const SPointNE* waypoints, uint32_t waypointCount, SRouteViolation* outViolation, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerDoesRouteIntersectPolygon);
+
+    *resultState = EResultState::OK;
+
+    if (outViolation == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    *outViolation = SRouteViolation{ true, 0, RAY_START_INSIDE, 0.0f, { 0.0f, 0.0f } };
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (waypoints == nullptr) {
+        *resultState = EResultState::POINTS_IS_NULL_PTR;
+        return;
+    }
+    if (waypointCount < 2) {
+        *resultState = EResultState::ROUTE_WITH_LESS_THAN_2_POINTS;
+        return;
+    }
+
+    *outViolation = FindRouteViolation(polygon, pointCount, waypoints, waypointCount);
+}
+
+
+void InitPolygonTracker(const SPointNE* polygon, uint16_t pointCount, SPolygonTracker* outTracker, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (outTracker == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    *outTracker = MakePolygonTracker(polygon, pointCount);
+}
+
+
+void isInsidePolygonTracked(const SPointNE* polygon, uint16_t pointCount, SPolygonTracker* tracker, const SPointNE testPoint, float radiusMeters, uint8_t* outResult, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerIsInsidePolygonTracked);
+
+    *outResult = true;
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (tracker == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (tracker->pointCount != pointCount) {
+        *resultState = EResultState::PREPARED_DATA_INVALID;
+        return;
+    }
+
+    *outResult = TrackPolygonQuery(*tracker, polygon, testPoint, radiusMeters);
+}
+
+
+void ImportGeoPolygon(const double originLatitudeDeg, const double originLongitudeDeg, const double originAltitude, const SPointGeo* ring, uint16_t ringCount, SPointNE* outPolygon, uint16_t outCapacity, uint16_t* outPointCount, SPolygonBounds* outBounds, uint8_t* resultState)
+{
+    API_TIMER(EApiTimerID::TimerImportGeoPolygon);
+
+    *resultState = EResultState::OK;
+
+    if (outPointCount == nullptr || outPolygon == nullptr || outBounds == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    *outPointCount = 0;
+
+    if (ring == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (ringCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (outCapacity < ringCount) {
+        *resultState = EResultState::OUTPUT_TOO_SMALL;
+        return;
+    }
+
+    const SLocalFrame frame = ComputeLocalFrame(originLatitudeDeg, originLongitudeDeg, originAltitude);
+    *outPointCount = ImportGeoRing(frame, ring, ringCount, outPolygon);
+    if (*outPointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+
+    *outBounds = ComputePolygonBounds(outPolygon, *outPointCount);
+}
+
+
+void InitPolygonConvexity(const SPointNE* polygon, uint16_t pointCount, SPolygonConvexity* outConvexity, uint8_t* resultState)
+{
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (outConvexity == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+
+    *outConvexity = ComputePolygonConvexity(polygon, pointCount);
+}
+
+
+void isInsidePolygonConvex(const SPointNE* polygon, uint16_t pointCount, const SPolygonConvexity* convexity, const SPointNE testPoint, float radiusMeters, uint8_t* outResult, uint8_t* resultState)
+{
+    *outResult = true;
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (convexity == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (convexity->pointCount != pointCount) {
+        *resultState = EResultState::PREPARED_DATA_INVALID;
+        return;
+    }
+
+    if (!convexity->isConvex) {
+        isInsidePolygon(polygon, pointCount, testPoint, radiusMeters, outResult, resultState);
+        return;
+    }
+    *outResult = IsInsideConvexPolygon(polygon, *convexity, testPoint, radiusMeters);
+}
+
+
+void doesLineIntersectPolygonConvex(const SPointNE* polygon, uint16_t pointCount, const SPolygonConvexity* convexity, const SPointNE testPoint, float azimuthDegrees, float maxLength, uint8_t* outResult, uint8_t* resultState)
+{
+    *outResult = true;
+    *resultState = EResultState::OK;
+
+    if (polygon == nullptr) {
+        *resultState = EResultState::POLYGON_IS_NULL_PTR;
+        return;
+    }
+    if (pointCount < 3) {
+        *resultState = EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        return;
+    }
+    if (maxLength <= 0.0f) {
+        *resultState = EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO;
+        return;
+    }
+    if (convexity == nullptr) {
+        *resultState = EResultState::BUFFER_IS_NULL_PTR;
+        return;
+    }
+    if (convexity->pointCount != pointCount) {
+        *resultState = EResultState::PREPARED_DATA_INVALID;
+        return;
+    }
+
+    if (!convexity->isConvex) {
+        doesLineIntersectPolygon(polygon, pointCount, testPoint, azimuthDegrees, maxLength, outResult, resultState);
+        return;
+    }
+    const SRayNE ray = { testPoint, azimuthDegrees, maxLength };
+    *outResult = DoesSegmentIntersectConvexPolygon(polygon, *convexity, testPoint, GetRayEndPoint(ray));
+}
+
+
+void isInsideMultiPolygon(const SPointNE* points, const uint32_t* ringOffsets, uint32_t ringCount, const SPointNE testPoint, float radiusMeters, uint8_t* outResult, uint8_t* resultState)
+{
+    *outResult = true;
+
+    const EResultState state = ValidatePolygonRings(points, ringOffsets, ringCount);
+    *resultState = state;
+    if (state != EResultState::OK) {
+        return;
+    }
+
+    *outResult = IsInsidePolygonRings(points, ringOffsets, ringCount, testPoint, radiusMeters);
+}
+
+
+void doesLineIntersectMultiPolygon(const SPointNE* points, const uint32_t* ringOffsets, uint32_t ringCount, const SPointNE testPoint, float azimuthDegrees, float maxLength, uint8_t* outResult, uint8_t* resultState)
+{
+    *outResult = true;
+
+    const EResultState state = ValidatePolygonRings(points, ringOffsets, ringCount);
+    *resultState = state;
+    if (state != EResultState::OK) {
+        return;
+    }
+    if (maxLength <= 0.0f) {
+        *resultState = EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO;
+        return;
+    }
+
+    const SRayNE ray = { testPoint, azimuthDegrees, maxLength };
+    *outResult = DoesSegmentIntersectPolygonRings(points, ringOffsets, ringCount, testPoint, GetRayEndPoint(ray));
+}
@@ -1,4 +1,5 @@
 #include "geometric_functions.h"
+#include "robust_predicates.h"
 
 
 // Checks if two double values are effectively equal.
@@ -9,71 +10,195 @@ bool areAlmostEqual(const float a, const float b) {
 
 // Calculates the squared Euclidean distance between two points.
 // Using squared distance avoids expensive square root operations during comparisons.
-double getDistSq(const SPointNE& a, const SPointNE& b) {
-    double dn = a.north - b.north;
-    double de = a.east - b.east;
+template <typename TPrecision>
+typename TPrecision::Real getDistSq(const SPointNE& a, const SPointNE& b) {
+    typedef typename TPrecision::Real Real;
+    Real dn = (Real)a.north - (Real)b.north;
+    Real de = (Real)a.east - (Real)b.east;
     return dn * dn + de * de;
 }
 
 // Calculates the squared shortest distance
 // from a point to a line segment.
-double getDistToSegmentSquared(const SPointNE& p, const SPointNE& a, const SPointNE& b) {
-    const float l2 = getDistSq(a, b);
+template <typename TPrecision>
+typename TPrecision::Real getDistToSegmentSquared(const SPointNE& p, const SPointNE& a, const SPointNE& b) {
+    typedef typename TPrecision::Real Real;
+    const Real l2 = getDistSq<TPrecision>(a, b);
 
     // If start and end points are identical, return distance to point 'a'
-    if (l2 == 0.0) return getDistSq(p, a);
+    if (l2 == (Real)0) return getDistSq<TPrecision>(p, a);
+
+    const Real abNorth = (Real)b.north - (Real)a.north;
+    const Real abEast = (Real)b.east - (Real)a.east;
+    const Real apNorth = (Real)p.north - (Real)a.north;
+    const Real apEast = (Real)p.east - (Real)a.east;
 
     // Calculate projection factor t represents the relative position of the projection on the infinite line:
     // 0.0 = Start (a), 1.0 = End (b).
     // t = [(p-a) . (b-a)] / |b-a|^2
-    float t = ((p.north - a.north) * (b.north - a.north) +
-        (p.east - a.east) * (b.east - a.east)) / l2;
+    Real t = (apNorth * abNorth + apEast * abEast) / l2;
 
     // Clamp t to the segment [0, 1] to handle points beyond endpoints
-    if (t < 0.0) t = 0.0;
-    else if (t > 1.0) t = 1.0;
-
-    SPointNE projection = {
-        a.north + t * (b.north - a.north),
-        a.east + t * (b.east - a.east)
-    };
+    if (t < (Real)0) t = (Real)0;
+    else if (t > (Real)1) t = (Real)1;
 
-    return getDistSq(p, projection);
+    // Distance from p to the projection a + t * (b - a), kept in Real (no rounding to float coordinates)
+    const Real dn = apNorth - t * abNorth;
+    const Real de = apEast - t * abEast;
+    return dn * dn + de * de;
 }
 
 // Checks if point q lies on the line segment pr.
 // Assumes points are already known to be collinear.
+template <typename TPrecision>
 bool onSegment(const SPointNE& p, const SPointNE& q, const SPointNE& r) {
-    return q.north <= MAX(p.north, r.north) && q.north >= MIN(p.north, r.north) &&
-        q.east <= MAX(p.east, r.east) && q.east >= MIN(p.east, r.east);
+    typedef typename TPrecision::Real Real;
+    return (Real)q.north <= MAX((Real)p.north, (Real)r.north) && (Real)q.north >= MIN((Real)p.north, (Real)r.north) &&
+        (Real)q.east <= MAX((Real)p.east, (Real)r.east) && (Real)q.east >= MIN((Real)p.east, (Real)r.east);
 }
 
 // Determines the orientation of the ordered triplet (p, q, r).
  // return 0 if collinear, 1 if clockwise, 2 if counter-clockwise.
+template <typename TPrecision>
 int orientation(const SPointNE& p, const SPointNE& q, const SPointNE& r) {
-    double val = (q.east - p.east) * (r.north - q.north) -
-        (q.north - p.north) * (r.east - q.east);
+    typedef typename TPrecision::Real Real;
+    const Real left = ((Real)q.east - (Real)p.east) * ((Real)r.north - (Real)q.north);
+    const Real right = ((Real)q.north - (Real)p.north) * ((Real)r.east - (Real)q.east);
+    const Real val = left - right;
+
+    Real tolerance = TPrecision::TOLERANCE;
+    if constexpr (TPrecision::RELATIVE_TOLERANCE > 0) {
+        tolerance += TPrecision::RELATIVE_TOLERANCE * (std::fabs(left) + std::fabs(right));
+    }
+    if (std::fabs(val) <= tolerance) return 0;
+    return (val > (Real)0) ? 1 : 2;
+}
 
-    if (areAlmostEqual(val, 0.0)) return 0;
-    return (val > 0) ? 1 : 2;
+// Exact sign (filtered, exact arithmetic only for near-collinear points): 0 means exactly collinear.
+template <>
+int orientation<SRobustPrecision>(const SPointNE& p, const SPointNE& q, const SPointNE& r) {
+    const int sign = Orient2dSign(p, q, r);
+    if (sign == 0) return 0;
+    return (sign > 0) ? 1 : 2;
 }
 
 // Checks if two line segments (p1-q1 and p2-q2) intersect.
 // Uses the general case and special cases (collinear points) of the orientation method.
+template <typename TPrecision>
 bool doSegmentsIntersect(const SPointNE& p1, const SPointNE& q1, const SPointNE& p2, const SPointNE& q2) {
-    int o1 = orientation(p1, q1, p2);
-    int o2 = orientation(p1, q1, q2);
-    int o3 = orientation(p2, q2, p1);
-    int o4 = orientation(p2, q2, q1);
+    int o1 = orientation<TPrecision>(p1, q1, p2);
+    int o2 = orientation<TPrecision>(p1, q1, q2);
+    int o3 = orientation<TPrecision>(p2, q2, p1);
+    int o4 = orientation<TPrecision>(p2, q2, q1);
 
     // General Case: Segments straddle each other
     if (o1 != o2 && o3 != o4) return true;
 
     // Special Cases: Collinear points lying on segments
-    if (o1 == 0 && onSegment(p1, p2, q1)) return true;
-    if (o2 == 0 && onSegment(p1, q2, q1)) return true;
-    if (o3 == 0 && onSegment(p2, p1, q2)) return true;
-    if (o4 == 0 && onSegment(p2, q1, q2)) return true;
+    if (o1 == 0 && onSegment<TPrecision>(p1, p2, q1)) return true;
+    if (o2 == 0 && onSegment<TPrecision>(p1, q2, q1)) return true;
+    if (o3 == 0 && onSegment<TPrecision>(p2, p1, q2)) return true;
+    if (o4 == 0 && onSegment<TPrecision>(p2, q1, q2)) return true;
 
     return false;
 }
+
+// --- Explicit instantiations (float fast path, double accurate path, robust path) ---
+
+#define INSTANTIATE_GEOMETRIC_KERNELS(TPrecision) \
+    template TPrecision::Real getDistSq<TPrecision>(const SPointNE&, const SPointNE&); \
+    template TPrecision::Real getDistToSegmentSquared<TPrecision>(const SPointNE&, const SPointNE&, const SPointNE&); \
+    template bool onSegment<TPrecision>(const SPointNE&, const SPointNE&, const SPointNE&); \
+    template bool doSegmentsIntersect<TPrecision>(const SPointNE&, const SPointNE&, const SPointNE&, const SPointNE&);
+
+INSTANTIATE_GEOMETRIC_KERNELS(SFloatPrecision)
+INSTANTIATE_GEOMETRIC_KERNELS(SDoublePrecision)
+INSTANTIATE_GEOMETRIC_KERNELS(SRobustPrecision)
+
+template int orientation<SFloatPrecision>(const SPointNE&, const SPointNE&, const SPointNE&);
+template int orientation<SDoublePrecision>(const SPointNE&, const SPointNE&, const SPointNE&);
+
+#undef INSTANTIATE_GEOMETRIC_KERNELS
+
+// --- Double path wrappers ---
+
+double getDistSq(const SPointNE& a, const SPointNE& b) {
+    return getDistSq<SDoublePrecision>(a, b);
+}
+
+double getDistToSegmentSquared(const SPointNE& p, const SPointNE& a, const SPointNE& b) {
+    return getDistToSegmentSquared<SDoublePrecision>(p, a, b);
+}
+
+bool onSegment(const SPointNE& p, const SPointNE& q, const SPointNE& r) {
+    return onSegment<SDoublePrecision>(p, q, r);
+}
+
+int orientation(const SPointNE& p, const SPointNE& q, const SPointNE& r) {
+    return orientation<SDoublePrecision>(p, q, r);
+}
+
+bool doSegmentsIntersect(const SPointNE& p1, const SPointNE& q1, const SPointNE& p2, const SPointNE& q2) {
+    return doSegmentsIntersect<SDoublePrecision>(p1, q1, p2, q2);
+}
+
+// Parametric position along p1-q1 (0 = p1, 1 = q1) of its first contact with segment p2-q2.
+// Meant for segments that doSegmentsIntersect reports as intersecting; the result is clamped to [0, 1].
+double getFirstContactParam(const SPointNE& p1, const SPointNE& q1, const SPointNE& p2, const SPointNE& q2) {
+    const double dn = (double)q1.north - p1.north;
+    const double de = (double)q1.east - p1.east;
+    const double en = (double)q2.north - p2.north;
+    const double ee = (double)q2.east - p2.east;
+    const double sn = (double)p2.north - p1.north;
+    const double se = (double)p2.east - p1.east;
+
+    double t;
+    const double denom = dn * ee - de * en;
+    if (std::fabs(denom) > EPSILON * std::sqrt((dn * dn + de * de) * (en * en + ee * ee))) {
+        // Crossing lines: solve p1 + t*d = p2 + u*e
+        t = (sn * ee - se * en) / denom;
+    }
+    else {
+        // Parallel (collinear overlap): the nearer projected end of p2-q2
+        const double lenSq = dn * dn + de * de;
+        if (lenSq == 0.0) return 0.0;
+        const double t0 = (sn * dn + se * de) / lenSq;
+        const double t1 = ((sn + en) * dn + (se + ee) * de) / lenSq;
+        t = MIN(t0, t1);
+    }
+
+    if (t < 0.0) t = 0.0;
+    else if (t > 1.0) t = 1.0;
+    return t;
+}
+
+// Checks if edge (a, b) straddles the East line of point p (half-open, so a vertex is counted once).
+bool doesEdgeStraddleEast(const SPointNE& a, const SPointNE& b, const SPointNE& p) {
+    return (a.east > p.east) != (b.east > p.east);
+}
+
+// Checks if a ray cast from p to the North crosses the straddling edge (a, b).
+// 'a' is the edge's base vertex for the interpolation, as in the original ray casting loop.
+bool doesRayCrossEdgeNorth(const SPointNE& a, const SPointNE& b, const SPointNE& p) {
+    // for safety of dividing by zero
+    float deltaEast = b.east - a.east;
+    if (std::abs(deltaEast) < EPSILON) {
+        return false;
+    }
+    // Calculate intersection on North axis
+    // y = y_1 + m*(x-x_1)
+    double intersectN = a.north + ((b.north - a.north) / deltaEast) * (p.east - a.east);
+
+    // Intersection strictly to the North of the point
+    return p.north < intersectN;
+}
+
+// Checks if a squared distance is strictly inside the radius (touching counts as outside).
+bool isWithinRadius(const double distSq, const float radiusMeters) {
+    return distSq < radiusMeters * radiusMeters && !areAlmostEqual(distSq, radiusMeters * radiusMeters);
+}
+
+// Checks if a squared distance means the point lies on the boundary.
+bool isOnBoundary(const double distSq) {
+    return areAlmostEqual(distSq, 0.0);
+}
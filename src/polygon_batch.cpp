@@ -0,0 +1,49 @@
+#include "polygon_batch.h"
+#include "geometric_functions.h"
+
+// --- main functions ---
+
+uint64_t IsInsidePolygonBlock(const SPointNE* polygon, uint16_t pointCount, const SPointNE* testPoints, uint32_t testCount, const float* radii, float radiusMeters) {
+    // --- Ray Casting, edge-major ---
+    // Same edge order and per-edge test as isInsidePolygon, so the parity is identical.
+    uint64_t insideMask = 0;
+    for (size_t i = 0, j = pointCount - 1; i < pointCount; j = i++) {
+        const SPointNE a = polygon[i];
+        const SPointNE b = polygon[j];
+        for (uint32_t p = 0; p < testCount; ++p) {
+            if (doesEdgeStraddleEast(a, b, testPoints[p]) && doesRayCrossEdgeNorth(a, b, testPoints[p])) {
+                insideMask ^= (uint64_t)1 << p;
+            }
+        }
+    }
+
+    // Points whose center is outside still need the distance pass
+    uint8_t pending[POLYGON_BATCH_BLOCK];
+    uint32_t pendingCount = 0;
+    for (uint32_t p = 0; p < testCount; ++p) {
+        if (!(insideMask & ((uint64_t)1 << p))) {
+            pending[pendingCount++] = (uint8_t)p;
+        }
+    }
+
+    // --- Distance pass, edge-major over the pending points ---
+    uint64_t resultMask = insideMask;
+    for (size_t i = 0; i < pointCount && pendingCount > 0; ++i) {
+        const SPointNE a = polygon[i];
+        const SPointNE b = polygon[(i + 1) % pointCount];
+        for (uint32_t k = 0; k < pendingCount; ) {
+            const uint8_t p = pending[k];
+            const float radius = (radii != nullptr) ? radii[p] : radiusMeters;
+            double dSq = getDistToSegmentSquared(testPoints[p], a, b);
+            if (isWithinRadius(dSq, radius) || isOnBoundary(dSq)) {
+                resultMask |= (uint64_t)1 << p;
+                // Decided: swap-remove from the pending list
+                pending[k] = pending[--pendingCount];
+                continue;
+            }
+            ++k;
+        }
+    }
+
+    return resultMask;
+}
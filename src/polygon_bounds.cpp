@@ -0,0 +1,87 @@
+#include "polygon_bounds.h"
+#include "geometric_functions.h"
+
+#include <cmath>
+
+// --- helper functions ---
+
+namespace {
+
+// Rejection margin over the polygon and the query
+inline double RejectMargin(const SPolygonBounds& bounds, float queryMaxCoord) {
+    return getSearchMargin(MAX(bounds.maxAbsCoord, queryMaxCoord));
+}
+
+// Written so that NaN never rejects
+inline bool IsBoxClear(const SPolygonBounds& bounds, double loNorth, double loEast, double hiNorth, double hiEast) {
+    return hiNorth < bounds.minNorth || loNorth > bounds.maxNorth || hiEast < bounds.minEast || loEast > bounds.maxEast;
+}
+
+} // namespace
+
+// --- main functions ---
+
+SPolygonBounds ComputePolygonBounds(const SPointNE* polygon, uint16_t pointCount) {
+    SPolygonBounds bounds;
+    bounds.pointCount = pointCount;
+    bounds.minNorth = bounds.maxNorth = polygon[0].north;
+    bounds.minEast = bounds.maxEast = polygon[0].east;
+    bounds.maxAbsCoord = 0.0f;
+    for (uint16_t i = 0; i < pointCount; ++i) {
+        bounds.minNorth = MIN(bounds.minNorth, polygon[i].north);
+        bounds.maxNorth = MAX(bounds.maxNorth, polygon[i].north);
+        bounds.minEast = MIN(bounds.minEast, polygon[i].east);
+        bounds.maxEast = MAX(bounds.maxEast, polygon[i].east);
+        bounds.maxAbsCoord = MAX(bounds.maxAbsCoord, MAX(std::fabs(polygon[i].north), std::fabs(polygon[i].east)));
+    }
+
+    bounds.center.north = (float)(0.5 * ((double)bounds.minNorth + bounds.maxNorth));
+    bounds.center.east = (float)(0.5 * ((double)bounds.minEast + bounds.maxEast));
+
+    double maxDistSq = 0.0;
+    for (uint16_t i = 0; i < pointCount; ++i) {
+        maxDistSq = MAX(maxDistSq, getDistSq(bounds.center, polygon[i]));
+    }
+    // Round up so the float radius still encloses every vertex
+    bounds.radius = std::nextafter((float)std::sqrt(maxDistSq), INFINITY);
+
+    return bounds;
+}
+
+
+EBoundsReject CheckCircleAgainstBounds(const SPolygonBounds& bounds, const SPointNE& testPoint, float radiusMeters) {
+    const double reach = std::fabs((double)radiusMeters) + RejectMargin(bounds, MAX(std::fabs(testPoint.north), std::fabs(testPoint.east)));
+
+    if (IsBoxClear(bounds, testPoint.north - reach, testPoint.east - reach, testPoint.north + reach, testPoint.east + reach)) {
+        return EBoundsReject::REJECT_BY_BOX;
+    }
+
+    const double limit = bounds.radius + reach;
+    if (getDistSq(testPoint, bounds.center) > limit * limit) {
+        return EBoundsReject::REJECT_BY_CIRCLE;
+    }
+
+    return EBoundsReject::REJECT_NONE;
+}
+
+
+EBoundsReject CheckSegmentAgainstBounds(const SPolygonBounds& bounds, const SPointNE& startPoint, const SPointNE& endPoint) {
+    const float queryMaxCoord = MAX(MAX(std::fabs(startPoint.north), std::fabs(startPoint.east)), MAX(std::fabs(endPoint.north), std::fabs(endPoint.east)));
+    if (!std::isfinite(queryMaxCoord)) {
+        return EBoundsReject::REJECT_NONE; // MIN/MAX below may drop a NaN
+    }
+    const double margin = RejectMargin(bounds, queryMaxCoord);
+
+    if (IsBoxClear(bounds,
+        MIN(startPoint.north, endPoint.north) - margin, MIN(startPoint.east, endPoint.east) - margin,
+        MAX(startPoint.north, endPoint.north) + margin, MAX(startPoint.east, endPoint.east) + margin)) {
+        return EBoundsReject::REJECT_BY_BOX;
+    }
+
+    const double limit = bounds.radius + margin;
+    if (getDistToSegmentSquared(bounds.center, startPoint, endPoint) > limit * limit) {
+        return EBoundsReject::REJECT_BY_CIRCLE;
+    }
+
+    return EBoundsReject::REJECT_NONE;
+}
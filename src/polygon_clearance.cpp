@@ -0,0 +1,37 @@
+#include "polygon_clearance.h"
+#include "geometric_functions.h"
+
+#include <cmath>
+
+// --- main functions ---
+
+SPolygonClearance ComputePolygonClearance(const SPointNE* polygon, uint16_t pointCount, const SPointNE& testPoint, float radiusMeters) {
+    bool isCenterInside = false;
+    double minDistSq = INFINITY;
+    uint16_t nearestEdge = 0;
+
+    // Edge k runs from vertex k to k + 1; the ray cast uses the same (a, b) order as isInsidePolygon
+    for (size_t k = 0; k < pointCount; ++k) {
+        const SPointNE& a = polygon[(k + 1) % pointCount];
+        const SPointNE& b = polygon[k];
+
+        if (doesEdgeStraddleEast(a, b, testPoint) && doesRayCrossEdgeNorth(a, b, testPoint)) {
+            isCenterInside = !isCenterInside;
+        }
+
+        double dSq = getDistToSegmentSquared(testPoint, b, a);
+        if (dSq < minDistSq) {
+            minDistSq = dSq;
+            nearestEdge = (uint16_t)k;
+        }
+    }
+
+    const double distance = std::sqrt(minDistSq);
+
+    SPolygonClearance result;
+    result.isCollision = isCenterInside || isWithinRadius(minDistSq, radiusMeters) || isOnBoundary(minDistSq);
+    result.nearestEdge = nearestEdge;
+    result.signedDistance = (float)(isCenterInside ? -distance : distance);
+    result.clearance = (float)(result.signedDistance - std::fabs((double)radiusMeters));
+    return result;
+}
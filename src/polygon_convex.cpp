@@ -0,0 +1,205 @@
+#include "polygon_convex.h"
+#include "api_functions.h"
+#include "geometric_functions.h"
+
+#include <cmath>
+
+// --- helper functions ---
+
+namespace {
+
+// (b - a) x (p - a), with north as the first axis
+inline double Cross(const SPointNE& a, const SPointNE& b, const SPointNE& p) {
+    return ((double)b.north - a.north) * ((double)p.east - a.east) - ((double)b.east - a.east) * ((double)p.north - a.north);
+}
+
+// Positive when p is on the inner side of the directed line a -> b
+inline double Side(const SPolygonConvexity& convexity, const SPointNE& a, const SPointNE& b, const SPointNE& p) {
+    return convexity.windingSign * Cross(a, b, p);
+}
+
+// Half turn of direction point - center, measured from reference - center in winding order:
+// 0 for [0, 180) degrees, 1 for [180, 360)
+inline int AngleHalf(const SPolygonConvexity& convexity, const SPointNE& reference, const SPointNE& point) {
+    const double side = Side(convexity, convexity.center, reference, point);
+    const double dot = ((double)reference.north - convexity.center.north) * ((double)point.north - convexity.center.north) +
+        ((double)reference.east - convexity.center.east) * ((double)point.east - convexity.center.east);
+    return (side > 0.0 || (side == 0.0 && dot > 0.0)) ? 0 : 1;
+}
+
+// Whether a comes no later than b going around the center in winding order, starting at reference
+inline bool IsAngleNotAfter(const SPolygonConvexity& convexity, const SPointNE& reference, const SPointNE& a, const SPointNE& b) {
+    const int halfA = AngleHalf(convexity, reference, a);
+    const int halfB = AngleHalf(convexity, reference, b);
+    if (halfA != halfB) return halfA < halfB;
+    return Side(convexity, convexity.center, a, b) >= 0.0;
+}
+
+// Sign changes of the edge direction along one axis, around the whole ring (zero steps skipped)
+int CountDirectionFlips(const SPointNE* polygon, uint16_t pointCount, bool alongNorth) {
+    int firstSign = 0;
+    int lastSign = 0;
+    int flips = 0;
+    for (uint16_t k = 0; k < pointCount; ++k) {
+        const SPointNE& a = polygon[k];
+        const SPointNE& b = polygon[(k + 1) % pointCount];
+        const double delta = alongNorth ? (double)b.north - a.north : (double)b.east - a.east;
+        const int sign = (delta > 0.0) - (delta < 0.0);
+        if (sign == 0) continue;
+        if (firstSign == 0) firstSign = sign;
+        else if (sign != lastSign) flips++;
+        lastSign = sign;
+    }
+    if (firstSign != lastSign) flips++;
+    return flips;
+}
+
+// Walks from an edge facing testPoint towards smaller distances; returns the squared distance
+// of the edge where the walk stops, the nearest one on a convex polygon.
+double WalkToNearestEdge(const SPointNE* polygon, uint16_t pointCount, uint16_t startEdge, const SPointNE& testPoint) {
+    double bestDistSq = getDistToSegmentSquared(testPoint, polygon[startEdge], polygon[(startEdge + 1) % pointCount]);
+
+    // Forward first; backward only if the first forward step does not improve
+    const uint16_t steps[2] = { 1, (uint16_t)(pointCount - 1) };
+    for (uint16_t step : steps) {
+        uint16_t edge = startEdge;
+        bool moved = false;
+        for (uint16_t visited = 1; visited < pointCount; ++visited) {
+            const uint16_t next = (uint16_t)((edge + step) % pointCount);
+            const double distSq = getDistToSegmentSquared(testPoint, polygon[next], polygon[(next + 1) % pointCount]);
+            if (!(distSq < bestDistSq)) break;
+            bestDistSq = distSq;
+            edge = next;
+            moved = true;
+        }
+        if (moved) break;
+    }
+    return bestDistSq;
+}
+
+} // namespace
+
+// --- main functions ---
+
+SPolygonConvexity ComputePolygonConvexity(const SPointNE* polygon, uint16_t pointCount) {
+    SPolygonConvexity convexity = { pointCount, false, 0, { 0.0f, 0.0f } };
+
+    int turnSign = 0;
+    for (uint16_t k = 0; k < pointCount; ++k) {
+        const SPointNE& a = polygon[(k + pointCount - 1) % pointCount];
+        const SPointNE& b = polygon[k];
+        const SPointNE& c = polygon[(k + 1) % pointCount];
+        if (!std::isfinite(b.north) || !std::isfinite(b.east)) return convexity;
+
+        const double inNorth = (double)b.north - a.north;
+        const double inEast = (double)b.east - a.east;
+        const double outNorth = (double)c.north - b.north;
+        const double outEast = (double)c.east - b.east;
+        if (outNorth == 0.0 && outEast == 0.0) return convexity; // Zero-length edge
+
+        const double turn = inNorth * outEast - inEast * outNorth;
+        if (turn == 0.0) {
+            if (inNorth * outNorth + inEast * outEast < 0.0) return convexity; // The ring doubles back
+            continue;
+        }
+        const int sign = (turn > 0.0) ? 1 : -1;
+        if (turnSign == 0) turnSign = sign;
+        else if (sign != turnSign) return convexity;
+    }
+    if (turnSign == 0) return convexity; // All vertices on one line
+
+    // Same-direction turns can still wind around more than once (a pentagram)
+    if (CountDirectionFlips(polygon, pointCount, true) > 2 || CountDirectionFlips(polygon, pointCount, false) > 2) {
+        return convexity;
+    }
+
+    // Vertex average as the center; the angular search needs it strictly inside, which a
+    // sliver can lose to the float rounding
+    double centerNorth = 0.0;
+    double centerEast = 0.0;
+    for (uint16_t k = 0; k < pointCount; ++k) {
+        centerNorth += polygon[k].north;
+        centerEast += polygon[k].east;
+    }
+    convexity.windingSign = (int8_t)turnSign;
+    convexity.center = { (float)(centerNorth / pointCount), (float)(centerEast / pointCount) };
+    for (uint16_t k = 0; k < pointCount; ++k) {
+        if (!(Side(convexity, polygon[k], polygon[(k + 1) % pointCount], convexity.center) > 0.0)) {
+            convexity.windingSign = 0;
+            return convexity;
+        }
+    }
+
+    convexity.isConvex = true;
+    return convexity;
+}
+
+
+bool IsInsideConvexPolygon(const SPointNE* polygon, const SPolygonConvexity& convexity, const SPointNE& testPoint, float radiusMeters) {
+    const uint16_t pointCount = convexity.pointCount;
+
+    // Non-finite inputs have no wedge: answer with the linear scan
+    if (!std::isfinite(testPoint.north) || !std::isfinite(testPoint.east) || !std::isfinite(radiusMeters)) {
+        uint8_t result = false;
+        uint8_t state = EResultState::OK;
+        isInsidePolygon(polygon, pointCount, testPoint, radiusMeters, &result, &state);
+        return result;
+    }
+
+    // Around the center the vertices come in winding order, so the wedge holding the test point
+    // is found by bisection on the angle. Beyond the wedge's edge the point is outside, and that
+    // edge faces it.
+    uint16_t lo = 0;
+    uint16_t hi = pointCount;
+    while (hi - lo > 1) {
+        const uint16_t mid = (uint16_t)((lo + hi) / 2);
+        if (IsAngleNotAfter(convexity, polygon[0], polygon[mid], testPoint)) lo = mid;
+        else hi = mid;
+    }
+    const uint16_t facingEdge = lo;
+    if (Side(convexity, polygon[facingEdge], polygon[(facingEdge + 1) % pointCount], testPoint) >= 0.0) {
+        return true;
+    }
+
+    const double distSq = WalkToNearestEdge(polygon, pointCount, facingEdge, testPoint);
+    return isWithinRadius(distSq, radiusMeters) || isOnBoundary(distSq);
+}
+
+
+bool DoesSegmentIntersectConvexPolygon(const SPointNE* polygon, const SPolygonConvexity& convexity, const SPointNE& startPoint, const SPointNE& endPoint) {
+    const uint16_t pointCount = convexity.pointCount;
+
+    // Start point inside or on the boundary (isOnBoundary), as isInsidePolygon(start, 0) in
+    // doesLineIntersectPolygon: the clip alone misses starts just outside an edge pointing away
+    if (IsInsideConvexPolygon(polygon, convexity, startPoint, 0.0f)) {
+        return true;
+    }
+
+    // Non-finite segments cannot be clipped: same edge tests as doesLineIntersectPolygon
+    if (!std::isfinite(startPoint.north) || !std::isfinite(startPoint.east) || !std::isfinite(endPoint.north) || !std::isfinite(endPoint.east)) {
+        for (uint16_t k = 0; k < pointCount; ++k) {
+            if (doSegmentsIntersect(startPoint, endPoint, polygon[k], polygon[(k + 1) % pointCount])) return true;
+        }
+        return false;
+    }
+
+    // Keep the part of start + t * (end - start), t in [0, 1], inside every widened half-plane
+    double tEnter = 0.0;
+    double tExit = 1.0;
+    for (uint16_t k = 0; k < pointCount; ++k) {
+        const SPointNE& a = polygon[k];
+        const SPointNE& b = polygon[(k + 1) % pointCount];
+        const double f0 = Side(convexity, a, b, startPoint) + SDoublePrecision::TOLERANCE;
+        const double f1 = Side(convexity, a, b, endPoint) + SDoublePrecision::TOLERANCE;
+
+        if (f0 < 0.0) {
+            if (f1 < 0.0) return false;
+            tEnter = MAX(tEnter, f0 / (f0 - f1));
+        }
+        else if (f1 < 0.0) {
+            tExit = MIN(tExit, f0 / (f0 - f1));
+        }
+        if (tEnter > tExit) return false;
+    }
+    return true;
+}
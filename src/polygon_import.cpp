@@ -0,0 +1,97 @@
+#include "polygon_import.h"
+#include "coords_conv_functions.h"
+#include "coords_conv_simd.h"
+#include "geometric_functions.h"
+
+// --- helper functions ---
+
+namespace {
+
+const uint32_t IMPORT_CHUNK_SIZE = 64;
+
+inline bool isSamePoint(const SPointNE& a, const SPointNE& b) {
+    return a.north == b.north && a.east == b.east;
+}
+
+// q adds nothing to the outline between p and r
+inline bool isRedundant(const SPointNE& p, const SPointNE& q, const SPointNE& r) {
+    return orientation(p, q, r) == 0 && onSegment(p, q, r);
+}
+
+// Appends point, first popping the kept vertices it makes redundant
+inline void PushVertex(SPointNE* polygon, uint16_t& count, const SPointNE& point) {
+    if (count > 0 && isSamePoint(polygon[count - 1], point)) {
+        return;
+    }
+    while (count >= 2 && isRedundant(polygon[count - 2], polygon[count - 1], point)) {
+        --count;
+    }
+    polygon[count++] = point;
+}
+
+// Drops redundant vertices around the seam between the last and the first vertex
+uint16_t CloseRing(SPointNE* polygon, uint16_t count) {
+    uint16_t first = 0;
+    bool changed = true;
+    while (changed && count - first >= 3) {
+        changed = false;
+        const uint16_t last = count - 1;
+        if (isSamePoint(polygon[last], polygon[first]) || isRedundant(polygon[last - 1], polygon[last], polygon[first])) {
+            --count;
+            changed = true;
+        } else if (isRedundant(polygon[last], polygon[first], polygon[first + 1])) {
+            ++first;
+            changed = true;
+        }
+    }
+
+    if (first > 0) {
+        for (uint16_t i = first; i < count; ++i) {
+            polygon[i - first] = polygon[i];
+        }
+        count -= first;
+    }
+    return count;
+}
+
+// Twice the area on a north-up map (east = x, north = y); negative when clockwise
+double SignedMapArea2(const SPointNE* polygon, uint16_t count) {
+    double sum = 0.0;
+    for (uint16_t i = 0, j = count - 1; i < count; j = i++) {
+        sum += (double)polygon[j].east * polygon[i].north - (double)polygon[i].east * polygon[j].north;
+    }
+    return sum;
+}
+
+} // namespace
+
+// --- main functions ---
+
+uint16_t ImportGeoRing(const SLocalFrame& frame, const SPointGeo* ring, uint16_t ringCount, SPointNE* outPolygon) {
+    uint16_t count = 0;
+
+    SPointECEF ecefChunk[IMPORT_CHUNK_SIZE];
+    for (uint32_t base = 0; base < ringCount; base += IMPORT_CHUNK_SIZE) {
+        const uint32_t chunkCount = MIN(ringCount - base, IMPORT_CHUNK_SIZE);
+        GeoToEcefDispatch(ECoordsKernel::KERNEL_REFERENCE, ring + base, chunkCount, ecefChunk);
+
+        for (uint32_t k = 0; k < chunkCount; ++k) {
+            const SPointNED ned = EcefToNed(frame, ecefChunk[k]);
+            PushVertex(outPolygon, count, SPointNE{ (float)ned.north, (float)ned.east });
+        }
+    }
+
+    count = CloseRing(outPolygon, count);
+    if (count < 3) {
+        return count;
+    }
+
+    if (SignedMapArea2(outPolygon, count) > 0.0) {
+        for (uint16_t i = 0, j = count - 1; i < j; ++i, --j) {
+            const SPointNE swap = outPolygon[i];
+            outPolygon[i] = outPolygon[j];
+            outPolygon[j] = swap;
+        }
+    }
+    return count;
+}
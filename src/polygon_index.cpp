@@ -0,0 +1,358 @@
+#include "polygon_index.h"
+#include "api_functions.h"
+#include "geometric_functions.h"
+#include "polygon_ray.h"
+#include "scratch_arena.h"
+
+#include <cmath>
+#include <cstring>
+
+// --- helper functions ---
+
+namespace {
+
+// Maps a coordinate to a slab/cell index. The mapping is monotone, so an interval [lo, hi]
+// always covers every index that any value inside it maps to.
+inline uint32_t SlabOf(double value, double minValue, double invSize, uint32_t count) {
+    double idx = std::floor((value - minValue) * invSize);
+    if (!(idx > 0.0)) return 0;
+    if (idx >= (double)(count - 1)) return count - 1;
+    return (uint32_t)idx;
+}
+
+inline const SPointNE* Vertices(const SPolygonIndexHeader* index) {
+    return reinterpret_cast<const SPointNE*>(reinterpret_cast<const uint8_t*>(index) + index->verticesOffset);
+}
+
+inline const uint32_t* Section32(const SPolygonIndexHeader* index, uint32_t offset) {
+    return reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(index) + offset);
+}
+
+inline const uint16_t* Section16(const SPolygonIndexHeader* index, uint32_t offset) {
+    return reinterpret_cast<const uint16_t*>(reinterpret_cast<const uint8_t*>(index) + offset);
+}
+
+// Geometry-only part of the header: bounding box, grid dimensions and scales.
+SPolygonIndexHeader ComputeIndexParams(const SPointNE* polygon, uint16_t pointCount) {
+    SPolygonIndexHeader header = {};
+    header.magic = POLYGON_INDEX_MAGIC;
+    header.pointCount = pointCount;
+
+    header.minNorth = header.maxNorth = polygon[0].north;
+    header.minEast = header.maxEast = polygon[0].east;
+    header.maxAbsCoord = 0.0f;
+    for (uint16_t i = 0; i < pointCount; ++i) {
+        header.minNorth = MIN(header.minNorth, polygon[i].north);
+        header.maxNorth = MAX(header.maxNorth, polygon[i].north);
+        header.minEast = MIN(header.minEast, polygon[i].east);
+        header.maxEast = MAX(header.maxEast, polygon[i].east);
+        header.maxAbsCoord = MAX(header.maxAbsCoord, MAX(std::fabs(polygon[i].north), std::fabs(polygon[i].east)));
+    }
+
+    // About one grid cell per edge, twice as many East slabs as grid columns
+    uint32_t side = (uint32_t)std::ceil(std::sqrt((double)pointCount));
+    header.gridRows = side;
+    header.gridCols = side;
+    header.columnCount = 2 * side;
+
+    const float extentNorth = header.maxNorth - header.minNorth;
+    const float extentEast = header.maxEast - header.minEast;
+    header.cellInvSizeNorth = (extentNorth > 0.0f) ? (float)(header.gridRows / (double)extentNorth) : 0.0f;
+    header.cellInvSizeEast = (extentEast > 0.0f) ? (float)(header.gridCols / (double)extentEast) : 0.0f;
+    header.columnInvWidth = (extentEast > 0.0f) ? (float)(header.columnCount / (double)extentEast) : 0.0f;
+
+    return header;
+}
+
+// Calls visit(row, col) for every grid cell edge (a, b) may pass through.
+// Each row band is padded by half a cell and each East range by one cell, so the rounding of the
+// clip never drops the cell of a point on the edge, while long diagonal edges stay O(length) in cells.
+template <typename TVisitor>
+void ForEachEdgeCell(const SPolygonIndexHeader& header, const SPointNE& a, const SPointNE& b, TVisitor visit) {
+    const uint32_t rowLo = SlabOf(MIN(a.north, b.north), header.minNorth, header.cellInvSizeNorth, header.gridRows);
+    const uint32_t rowHi = SlabOf(MAX(a.north, b.north), header.minNorth, header.cellInvSizeNorth, header.gridRows);
+    const uint32_t colLo = SlabOf(MIN(a.east, b.east), header.minEast, header.cellInvSizeEast, header.gridCols);
+    const uint32_t colHi = SlabOf(MAX(a.east, b.east), header.minEast, header.cellInvSizeEast, header.gridCols);
+
+    const double deltaNorth = (double)b.north - a.north;
+    const double deltaEast = (double)b.east - a.east;
+
+    for (uint32_t r = rowLo; r <= rowHi; ++r) {
+        uint32_t cLo = colLo;
+        uint32_t cHi = colHi;
+
+        if (rowLo != rowHi && header.cellInvSizeNorth > 0.0f && std::fabs(deltaNorth) > 0.0) {
+            const double cellSize = 1.0 / header.cellInvSizeNorth;
+            const double bandLo = header.minNorth + (r - 0.5) * cellSize;
+            const double bandHi = header.minNorth + (r + 1.5) * cellSize;
+
+            double t0 = (bandLo - a.north) / deltaNorth;
+            double t1 = (bandHi - a.north) / deltaNorth;
+            if (t0 > t1) { double tmp = t0; t0 = t1; t1 = tmp; }
+            t0 = MAX(t0, 0.0);
+            t1 = MIN(t1, 1.0);
+
+            const double e0 = a.east + t0 * deltaEast;
+            const double e1 = a.east + t1 * deltaEast;
+            const uint32_t c0 = SlabOf(MIN(e0, e1), header.minEast, header.cellInvSizeEast, header.gridCols);
+            const uint32_t c1 = SlabOf(MAX(e0, e1), header.minEast, header.cellInvSizeEast, header.gridCols);
+            cLo = MAX(colLo, (c0 > 0) ? c0 - 1 : 0);
+            cHi = MIN(colHi, c1 + 1);
+        }
+
+        for (uint32_t c = cLo; c <= cHi; ++c) {
+            visit(r, c);
+        }
+    }
+}
+
+// East slabs an edge overlaps (used by the ray cast).
+void GetEdgeColumns(const SPolygonIndexHeader& header, const SPointNE& a, const SPointNE& b, uint32_t* colLo, uint32_t* colHi) {
+    *colLo = SlabOf(MIN(a.east, b.east), header.minEast, header.columnInvWidth, header.columnCount);
+    *colHi = SlabOf(MAX(a.east, b.east), header.minEast, header.columnInvWidth, header.columnCount);
+}
+
+// Lays the sections out in arena (buffer order) and fills the header offsets and total size.
+// Fails with BUFFER_TOO_SMALL when they do not fit the arena.
+EResultState ComputeIndexLayout(const SPointNE* polygon, SPolygonIndexHeader& header, SArena& arena) {
+    uint64_t columnEntries = 0;
+    uint64_t cellEntries = 0;
+    for (uint16_t k = 0; k < header.pointCount; ++k) {
+        const SPointNE& a = polygon[k];
+        const SPointNE& b = polygon[(k + 1) % header.pointCount];
+        uint32_t colLo, colHi;
+        GetEdgeColumns(header, a, b, &colLo, &colHi);
+        columnEntries += colHi - colLo + 1;
+        ForEachEdgeCell(header, a, b, [&cellEntries](uint32_t, uint32_t) { cellEntries++; });
+    }
+
+    uint32_t headerOffset = 0;
+    uint32_t endOffset = 0;
+    EResultState state = ArenaReserve(arena, sizeof(SPolygonIndexHeader), POLYGON_INDEX_ALIGNMENT, &headerOffset);
+    if (state == EResultState::OK) state = ArenaReserve(arena, (uint64_t)header.pointCount * sizeof(SPointNE), POLYGON_INDEX_ALIGNMENT, &header.verticesOffset);
+    if (state == EResultState::OK) state = ArenaReserve(arena, ((uint64_t)header.columnCount + 1) * sizeof(uint32_t), POLYGON_INDEX_ALIGNMENT, &header.columnStartOffset);
+    if (state == EResultState::OK) state = ArenaReserve(arena, columnEntries * sizeof(uint16_t), POLYGON_INDEX_ALIGNMENT, &header.columnEdgesOffset);
+    if (state == EResultState::OK) state = ArenaReserve(arena, ((uint64_t)header.gridRows * header.gridCols + 1) * sizeof(uint32_t), POLYGON_INDEX_ALIGNMENT, &header.cellStartOffset);
+    if (state == EResultState::OK) state = ArenaReserve(arena, cellEntries * sizeof(uint16_t), POLYGON_INDEX_ALIGNMENT, &header.cellEdgesOffset);
+    // Pad the end so indices stored back to back stay aligned
+    if (state == EResultState::OK) state = ArenaReserve(arena, 0, POLYGON_INDEX_ALIGNMENT, &endOffset);
+
+    header.totalSize = endOffset;
+    return state;
+}
+
+// Turns per-bucket counts stored at start[b + 1] into start offsets (start[0] = 0).
+void PrefixSum(uint32_t* start, uint32_t bucketCount) {
+    start[0] = 0;
+    for (uint32_t b = 0; b < bucketCount; ++b) {
+        start[b + 1] += start[b];
+    }
+}
+
+// After filling with start[b]++ as the write cursor, start[b] holds the end of bucket b; shift back.
+void RestoreStarts(uint32_t* start, uint32_t bucketCount) {
+    for (uint32_t b = bucketCount; b > 0; --b) {
+        start[b] = start[b - 1];
+    }
+    start[0] = 0;
+}
+
+} // namespace
+
+// --- main functions ---
+
+EResultState GetPolygonIndexSize(const SPointNE* polygon, uint16_t pointCount, uint32_t* outSizeBytes) {
+    *outSizeBytes = 0;
+
+    if (polygon == nullptr) return EResultState::POLYGON_IS_NULL_PTR;
+    if (pointCount < 3) return EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+
+    // Measuring arena: the whole 32-bit range, no memory
+    SArena arena;
+    InitArena(arena, nullptr, UINT32_MAX);
+    SPolygonIndexHeader header = ComputeIndexParams(polygon, pointCount);
+    if (ComputeIndexLayout(polygon, header, arena) != EResultState::OK) return EResultState::INDEX_TOO_LARGE;
+
+    *outSizeBytes = header.totalSize;
+    return EResultState::OK;
+}
+
+
+EResultState PreparePolygonIndex(const SPointNE* polygon, uint16_t pointCount, uint8_t* buffer, uint32_t bufferSize) {
+    if (polygon == nullptr) return EResultState::POLYGON_IS_NULL_PTR;
+    if (pointCount < 3) return EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+    if (buffer == nullptr) return EResultState::BUFFER_IS_NULL_PTR;
+    if (reinterpret_cast<uintptr_t>(buffer) % POLYGON_INDEX_ALIGNMENT != 0) return EResultState::BUFFER_NOT_ALIGNED;
+
+    SArena arena;
+    InitArena(arena, nullptr, UINT32_MAX);
+    SPolygonIndexHeader header = ComputeIndexParams(polygon, pointCount);
+    if (ComputeIndexLayout(polygon, header, arena) != EResultState::OK) return EResultState::INDEX_TOO_LARGE;
+    if (header.totalSize > bufferSize) return EResultState::BUFFER_TOO_SMALL;
+
+    std::memset(buffer, 0, (size_t)header.totalSize);
+    std::memcpy(buffer, &header, sizeof(header));
+    std::memcpy(buffer + header.verticesOffset, polygon, (size_t)pointCount * sizeof(SPointNE));
+
+    uint32_t* columnStart = reinterpret_cast<uint32_t*>(buffer + header.columnStartOffset);
+    uint16_t* columnEdges = reinterpret_cast<uint16_t*>(buffer + header.columnEdgesOffset);
+    uint32_t* cellStart = reinterpret_cast<uint32_t*>(buffer + header.cellStartOffset);
+    uint16_t* cellEdges = reinterpret_cast<uint16_t*>(buffer + header.cellEdgesOffset);
+    const uint32_t cellCount = header.gridRows * header.gridCols;
+
+    // 1. Count entries per bucket
+    for (uint16_t k = 0; k < pointCount; ++k) {
+        const SPointNE& a = polygon[k];
+        const SPointNE& b = polygon[(k + 1) % pointCount];
+        uint32_t colLo, colHi;
+        GetEdgeColumns(header, a, b, &colLo, &colHi);
+        for (uint32_t c = colLo; c <= colHi; ++c) {
+            columnStart[c + 1]++;
+        }
+        ForEachEdgeCell(header, a, b, [&](uint32_t r, uint32_t c) { cellStart[r * header.gridCols + c + 1]++; });
+    }
+    PrefixSum(columnStart, header.columnCount);
+    PrefixSum(cellStart, cellCount);
+
+    // 2. Scatter edge indices (counting sort, no scratch memory)
+    for (uint16_t k = 0; k < pointCount; ++k) {
+        const SPointNE& a = polygon[k];
+        const SPointNE& b = polygon[(k + 1) % pointCount];
+        uint32_t colLo, colHi;
+        GetEdgeColumns(header, a, b, &colLo, &colHi);
+        for (uint32_t c = colLo; c <= colHi; ++c) {
+            columnEdges[columnStart[c]++] = k;
+        }
+        ForEachEdgeCell(header, a, b, [&](uint32_t r, uint32_t c) { cellEdges[cellStart[r * header.gridCols + c]++] = k; });
+    }
+    RestoreStarts(columnStart, header.columnCount);
+    RestoreStarts(cellStart, cellCount);
+
+    return EResultState::OK;
+}
+
+
+const SPolygonIndexHeader* GetPolygonIndexHeader(const uint8_t* prepared, EResultState* outState) {
+    if (prepared == nullptr) {
+        *outState = EResultState::BUFFER_IS_NULL_PTR;
+        return nullptr;
+    }
+    if (reinterpret_cast<uintptr_t>(prepared) % POLYGON_INDEX_ALIGNMENT != 0) {
+        *outState = EResultState::BUFFER_NOT_ALIGNED;
+        return nullptr;
+    }
+
+    const SPolygonIndexHeader* index = reinterpret_cast<const SPolygonIndexHeader*>(prepared);
+    if (index->magic != POLYGON_INDEX_MAGIC || index->pointCount < 3) {
+        *outState = EResultState::PREPARED_DATA_INVALID;
+        return nullptr;
+    }
+
+    *outState = EResultState::OK;
+    return index;
+}
+
+
+bool IsInsidePolygonIndexed(const SPolygonIndexHeader* index, const SPointNE& testPoint, float radiusMeters) {
+    const SPointNE* polygon = Vertices(index);
+    const uint16_t pointCount = index->pointCount;
+
+    // Non-finite inputs cannot be mapped to the grid: answer with the linear scan
+    if (!std::isfinite(testPoint.north) || !std::isfinite(testPoint.east) || !std::isfinite(radiusMeters)) {
+        uint8_t result = false;
+        uint8_t state = EResultState::OK;
+        isInsidePolygon(polygon, pointCount, testPoint, radiusMeters, &result, &state);
+        return result;
+    }
+
+    // --- Ray Casting over the test point's East slab only ---
+    // An edge straddles the point's East line only if min(east) <= point.east < max(east),
+    // so a point outside [minEast, maxEast) has no crossings at all.
+    bool isCenterInside = false;
+    if (testPoint.east >= index->minEast && testPoint.east < index->maxEast) {
+        const uint32_t* columnStart = Section32(index, index->columnStartOffset);
+        const uint16_t* columnEdges = Section16(index, index->columnEdgesOffset);
+        const uint32_t column = SlabOf(testPoint.east, index->minEast, index->columnInvWidth, index->columnCount);
+
+        for (uint32_t e = columnStart[column]; e < columnStart[column + 1]; ++e) {
+            const uint16_t k = columnEdges[e];
+            const SPointNE& a = polygon[(k + 1) % pointCount];
+            const SPointNE& b = polygon[k];
+            if (doesEdgeStraddleEast(a, b, testPoint) && doesRayCrossEdgeNorth(a, b, testPoint)) {
+                isCenterInside = !isCenterInside;
+            }
+        }
+    }
+
+    if (isCenterInside) {
+        return true;
+    }
+
+    // --- Distance pass over the cells the circle can reach ---
+    const float maxCoord = MAX(index->maxAbsCoord, MAX(std::fabs(testPoint.north), std::fabs(testPoint.east)));
+    const double reach = std::fabs((double)radiusMeters) + getSearchMargin(maxCoord);
+
+    const double loNorth = testPoint.north - reach, hiNorth = testPoint.north + reach;
+    const double loEast = testPoint.east - reach, hiEast = testPoint.east + reach;
+    if (hiNorth < index->minNorth || loNorth > index->maxNorth || hiEast < index->minEast || loEast > index->maxEast) {
+        return false;
+    }
+
+    const uint32_t* cellStart = Section32(index, index->cellStartOffset);
+    const uint16_t* cellEdges = Section16(index, index->cellEdgesOffset);
+    const uint32_t rowLo = SlabOf(loNorth, index->minNorth, index->cellInvSizeNorth, index->gridRows);
+    const uint32_t rowHi = SlabOf(hiNorth, index->minNorth, index->cellInvSizeNorth, index->gridRows);
+    const uint32_t colLo = SlabOf(loEast, index->minEast, index->cellInvSizeEast, index->gridCols);
+    const uint32_t colHi = SlabOf(hiEast, index->minEast, index->cellInvSizeEast, index->gridCols);
+
+    for (uint32_t r = rowLo; r <= rowHi; ++r) {
+        for (uint32_t c = colLo; c <= colHi; ++c) {
+            const uint32_t cell = r * index->gridCols + c;
+            for (uint32_t e = cellStart[cell]; e < cellStart[cell + 1]; ++e) {
+                const uint16_t k = cellEdges[e];
+                double dSq = getDistToSegmentSquared(testPoint, polygon[k], polygon[(k + 1) % pointCount]);
+                if (isWithinRadius(dSq, radiusMeters) || isOnBoundary(dSq)) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+
+SRayHit CastRayIndexed(const SPolygonIndexHeader* index, const SRayNE& ray) {
+    const SPointNE* polygon = Vertices(index);
+    const uint16_t pointCount = index->pointCount;
+    const SPointNE endPoint = GetRayEndPoint(ray);
+
+    // Non-finite rays cannot be mapped to the grid: answer with the linear scan
+    if (!std::isfinite(endPoint.north) || !std::isfinite(endPoint.east) ||
+        !std::isfinite(ray.startPoint.north) || !std::isfinite(ray.startPoint.east)) {
+        return CastRayPolygon(polygon, pointCount, ray);
+    }
+
+    if (IsInsidePolygonIndexed(index, ray.startPoint, 0.0f)) {
+        return MakeRayHit(ray, endPoint, 0.0, RAY_START_INSIDE);
+    }
+
+    // A contact point lies on both the edge and the ray, so it falls in a cell listed for the edge
+    // (edge cells are padded) and in a cell the ray is rasterised into by the same routine.
+    double bestT = 2.0;
+    uint16_t bestEdge = RAY_START_INSIDE;
+    const uint32_t* cellStart = Section32(index, index->cellStartOffset);
+    const uint16_t* cellEdges = Section16(index, index->cellEdgesOffset);
+    ForEachEdgeCell(*index, ray.startPoint, endPoint, [&](uint32_t r, uint32_t c) {
+        const uint32_t cell = r * index->gridCols + c;
+        for (uint32_t e = cellStart[cell]; e < cellStart[cell + 1]; ++e) {
+            const uint16_t k = cellEdges[e];
+            UpdateFirstContact(ray, endPoint, polygon[k], polygon[(k + 1) % pointCount], k, &bestT, &bestEdge);
+        }
+    });
+
+    if (bestT > 1.0) {
+        return SRayHit{ false, RAY_START_INSIDE, 0.0f, ray.startPoint };
+    }
+    return MakeRayHit(ray, endPoint, bestT, bestEdge);
+}
@@ -0,0 +1,65 @@
+#include "polygon_ray.h"
+#include "api_functions.h"
+#include "geometric_functions.h"
+#include "coords_conv_functions.h"
+
+// --- helper functions ---
+
+SPointNE GetRayEndPoint(const SRayNE& ray) {
+    // NED System: Azimuth 0 is North (+X), 90 is East (+Y).
+    double thetaRad = ray.azimuthDegrees * (PI / 180.0);
+    SPointNE endPoint;
+    endPoint.north = ray.startPoint.north + ray.maxLength * std::cos(thetaRad);
+    endPoint.east = ray.startPoint.east + ray.maxLength * std::sin(thetaRad);
+    return endPoint;
+}
+
+
+SRayHit MakeRayHit(const SRayNE& ray, const SPointNE& endPoint, double t, uint16_t edgeIndex) {
+    SRayHit hit;
+    hit.isHit = true;
+    hit.edgeIndex = edgeIndex;
+    hit.distance = (float)(t * ray.maxLength);
+    hit.hitPoint.north = (float)(ray.startPoint.north + t * ((double)endPoint.north - ray.startPoint.north));
+    hit.hitPoint.east = (float)(ray.startPoint.east + t * ((double)endPoint.east - ray.startPoint.east));
+    return hit;
+}
+
+
+void UpdateFirstContact(const SRayNE& ray, const SPointNE& endPoint, const SPointNE& a, const SPointNE& b, uint16_t k, double* bestT, uint16_t* bestEdge) {
+    if (!doSegmentsIntersect(ray.startPoint, endPoint, a, b)) {
+        return;
+    }
+
+    double t = getFirstContactParam(ray.startPoint, endPoint, a, b);
+    if (t < *bestT || (t == *bestT && k < *bestEdge)) {
+        *bestT = t;
+        *bestEdge = k;
+    }
+}
+
+// --- main functions ---
+
+SRayHit CastRayPolygon(const SPointNE* polygon, uint16_t pointCount, const SRayNE& ray) {
+    const SPointNE endPoint = GetRayEndPoint(ray);
+
+    // If the Start Point is inside the polygon, it is an immediate intersection.
+    uint8_t isStartInside = false;
+    uint8_t state = EResultState::OK;
+    isInsidePolygon(polygon, pointCount, ray.startPoint, 0.0, &isStartInside, &state);
+    if (isStartInside) {
+        return MakeRayHit(ray, endPoint, 0.0, RAY_START_INSIDE);
+    }
+
+    // Earliest contact over all Polygon Edges (bestT > 1 means no contact)
+    double bestT = 2.0;
+    uint16_t bestEdge = RAY_START_INSIDE;
+    for (size_t i = 0; i < pointCount; ++i) {
+        UpdateFirstContact(ray, endPoint, polygon[i], polygon[(i + 1) % pointCount], (uint16_t)i, &bestT, &bestEdge);
+    }
+
+    if (bestT > 1.0) {
+        return SRayHit{ false, RAY_START_INSIDE, 0.0f, ray.startPoint };
+    }
+    return MakeRayHit(ray, endPoint, bestT, bestEdge);
+}
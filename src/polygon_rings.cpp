@@ -0,0 +1,78 @@
+#include "polygon_rings.h"
+#include "geometric_functions.h"
+
+// --- helper functions ---
+
+namespace {
+
+// Even-odd ray cast over every ring, edges (i, j) with j the previous vertex as in isInsidePolygon
+bool IsInsideRingsParity(const SPointNE* points, const uint32_t* ringOffsets, uint32_t ringCount, const SPointNE& testPoint) {
+    bool isInside = false;
+    for (uint32_t r = 0; r < ringCount; ++r) {
+        const uint32_t end = ringOffsets[r + 1];
+        for (uint32_t i = ringOffsets[r], j = end - 1; i < end; j = i++) {
+            if (doesEdgeStraddleEast(points[i], points[j], testPoint) && doesRayCrossEdgeNorth(points[i], points[j], testPoint)) {
+                isInside = !isInside;
+            }
+        }
+    }
+    return isInside;
+}
+
+// Whether any edge of any ring is within the radius of testPoint, or touches it
+bool IsNearRingsBoundary(const SPointNE* points, const uint32_t* ringOffsets, uint32_t ringCount, const SPointNE& testPoint, float radiusMeters) {
+    for (uint32_t r = 0; r < ringCount; ++r) {
+        const uint32_t end = ringOffsets[r + 1];
+        for (uint32_t i = ringOffsets[r], j = end - 1; i < end; j = i++) {
+            const double dSq = getDistToSegmentSquared(testPoint, points[j], points[i]);
+            if (isWithinRadius(dSq, radiusMeters) || isOnBoundary(dSq)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// --- main functions ---
+
+EResultState ValidatePolygonRings(const SPointNE* points, const uint32_t* ringOffsets, uint32_t ringCount) {
+    if (points == nullptr) return EResultState::POLYGON_IS_NULL_PTR;
+    if (ringOffsets == nullptr) return EResultState::BUFFER_IS_NULL_PTR;
+    if (ringCount == 0) return EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+
+    for (uint32_t r = 0; r < ringCount; ++r) {
+        if (ringOffsets[r + 1] < ringOffsets[r] || ringOffsets[r + 1] - ringOffsets[r] < 3) {
+            return EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+        }
+    }
+    return EResultState::OK;
+}
+
+
+bool IsInsidePolygonRings(const SPointNE* points, const uint32_t* ringOffsets, uint32_t ringCount, const SPointNE& testPoint, float radiusMeters) {
+    // A center inside the zone collides whatever the radius, and the parity pass is the cheap one
+    if (IsInsideRingsParity(points, ringOffsets, ringCount, testPoint)) {
+        return true;
+    }
+    return IsNearRingsBoundary(points, ringOffsets, ringCount, testPoint, radiusMeters);
+}
+
+
+bool DoesSegmentIntersectPolygonRings(const SPointNE* points, const uint32_t* ringOffsets, uint32_t ringCount, const SPointNE& startPoint, const SPointNE& endPoint) {
+    if (IsInsideRingsParity(points, ringOffsets, ringCount, startPoint)) {
+        return true;
+    }
+
+    for (uint32_t r = 0; r < ringCount; ++r) {
+        const uint32_t end = ringOffsets[r + 1];
+        for (uint32_t i = ringOffsets[r], j = end - 1; i < end; j = i++) {
+            // Start point on the boundary, or any contact with the edge
+            if (isOnBoundary(getDistToSegmentSquared(startPoint, points[j], points[i])) || doSegmentsIntersect(startPoint, endPoint, points[j], points[i])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
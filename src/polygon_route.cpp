@@ -0,0 +1,61 @@
+#include "polygon_route.h"
+#include "api_functions.h"
+#include "geometric_functions.h"
+#include "polygon_ray.h"
+
+// --- helper functions ---
+
+namespace {
+
+SRouteViolation MakeViolation(const SPointNE& start, const SPointNE& end, uint32_t leg, uint16_t edge, double t) {
+    SRouteViolation violation;
+    violation.isViolation = true;
+    violation.legIndex = leg;
+    violation.edgeIndex = edge;
+    violation.legParam = (float)t;
+    violation.hitPoint.north = (float)(start.north + t * ((double)end.north - start.north));
+    violation.hitPoint.east = (float)(start.east + t * ((double)end.east - start.east));
+    return violation;
+}
+
+} // namespace
+
+// --- main functions ---
+
+SRouteViolation FindRouteViolation(const SPointNE* polygon, uint16_t pointCount, const SPointNE* waypoints, uint32_t waypointCount) {
+    // A route that starts inside the polygon violates it on its first leg
+    uint8_t isStartInside = false;
+    uint8_t state = EResultState::OK;
+    isInsidePolygon(polygon, pointCount, waypoints[0], 0.0, &isStartInside, &state);
+    if (isStartInside) {
+        return MakeViolation(waypoints[0], waypoints[0], 0, RAY_START_INSIDE, 0.0);
+    }
+
+    for (uint32_t leg = 0; leg + 1 < waypointCount; ++leg) {
+        const SPointNE& start = waypoints[leg];
+        const SPointNE& end = waypoints[leg + 1];
+
+        // Earliest contact along this leg (bestT > 1 means no contact)
+        double bestT = 2.0;
+        uint16_t bestEdge = RAY_START_INSIDE;
+        for (size_t k = 0; k < pointCount; ++k) {
+            const SPointNE& a = polygon[k];
+            const SPointNE& b = polygon[(k + 1) % pointCount];
+            if (!doSegmentsIntersect(start, end, a, b)) {
+                continue;
+            }
+
+            double t = getFirstContactParam(start, end, a, b);
+            if (t < bestT) {
+                bestT = t;
+                bestEdge = (uint16_t)k;
+            }
+        }
+
+        if (bestT <= 1.0) {
+            return MakeViolation(start, end, leg, bestEdge, bestT);
+        }
+    }
+
+    return SRouteViolation{ false, ROUTE_NO_LEG, RAY_START_INSIDE, 0.0f, waypoints[0] };
+}
@@ -0,0 +1,70 @@
+#include "polygon_tracker.h"
+#include "polygon_clearance.h"
+#include "geometric_functions.h"
+#include "cov_spy.h"
+
+#include <cmath>
+
+// --- helper functions ---
+
+namespace {
+
+// Search margin over the polygon, the anchor and the query; it also covers the rounding of anchorDistance
+inline double TrackMargin(const SPolygonTracker& tracker, const SPointNE& testPoint) {
+    const float queryMaxCoord = MAX(std::fabs(testPoint.north), std::fabs(testPoint.east));
+    const float anchorMaxCoord = MAX(std::fabs(tracker.anchor.north), std::fabs(tracker.anchor.east));
+    return getSearchMargin(MAX(tracker.maxAbsCoord, MAX(queryMaxCoord, anchorMaxCoord)));
+}
+
+} // namespace
+
+// --- main functions ---
+
+SPolygonTracker MakePolygonTracker(const SPointNE* polygon, uint16_t pointCount) {
+    SPolygonTracker tracker = {};
+    tracker.pointCount = pointCount;
+    tracker.hasAnchor = false;
+    tracker.lastResult = true;
+    for (uint16_t i = 0; i < pointCount; ++i) {
+        tracker.maxAbsCoord = MAX(tracker.maxAbsCoord, MAX(std::fabs(polygon[i].north), std::fabs(polygon[i].east)));
+    }
+    return tracker;
+}
+
+
+bool TrackPolygonQuery(SPolygonTracker& tracker, const SPointNE* polygon, const SPointNE& testPoint, float radiusMeters) {
+    REJECT_COUNT(ERejectCounterID::TrackerQueries);
+    const double radius = std::fabs((double)radiusMeters);
+
+    if (tracker.hasAnchor) {
+        const double dn = (double)testPoint.north - tracker.anchor.north;
+        const double de = (double)testPoint.east - tracker.anchor.east;
+        const double reach = std::sqrt(dn * dn + de * de) + TrackMargin(tracker, testPoint);
+        const double nearest = tracker.anchorDistance - reach; // lower bound of the new distance
+
+        // Written so that NaN never reuses the anchor
+        if (tracker.isAnchorInside && reach < tracker.anchorDistance) {
+            REJECT_COUNT(ERejectCounterID::TrackerReuses);
+            tracker.lastResult = true;
+            tracker.lastClearance = (float)(-nearest - radius);
+            return true;
+        }
+        if (!tracker.isAnchorInside && nearest > radius) {
+            REJECT_COUNT(ERejectCounterID::TrackerReuses);
+            tracker.lastResult = false;
+            tracker.lastClearance = (float)(nearest - radius);
+            return false;
+        }
+    }
+
+    // Near the boundary (or first query): full evaluation, which becomes the new anchor
+    const SPolygonClearance clearance = ComputePolygonClearance(polygon, tracker.pointCount, testPoint, radiusMeters);
+    tracker.hasAnchor = true;
+    tracker.isAnchorInside = clearance.signedDistance < 0.0f;
+    tracker.nearestEdge = clearance.nearestEdge;
+    tracker.anchor = testPoint;
+    tracker.anchorDistance = std::fabs(clearance.signedDistance);
+    tracker.lastResult = clearance.isCollision;
+    tracker.lastClearance = clearance.clearance;
+    return clearance.isCollision;
+}
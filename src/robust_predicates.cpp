@@ -0,0 +1,81 @@
+#include "robust_predicates.h"
+#include "cov_spy.h"
+
+#include <cmath>
+#include <limits>
+
+// --- helper functions ---
+
+namespace {
+
+// Shewchuk's orient2d filter bound (3 + 16 eps) * eps, eps = 2^-53 being the double unit roundoff
+const double ORIENT_ERROR_BOUND = (3.0 + 16.0 * (std::numeric_limits<double>::epsilon() / 2.0)) * (std::numeric_limits<double>::epsilon() / 2.0);
+
+// Exact a + b as the rounded sum plus its rounding error (Knuth's two-sum)
+inline void TwoSum(double a, double b, double* sum, double* error) {
+    const double x = a + b;
+    const double bVirtual = x - a;
+    const double aVirtual = x - bVirtual;
+    *error = (a - aVirtual) + (b - bVirtual);
+    *sum = x;
+}
+
+// 0 for NaN
+inline int Sign(double value) {
+    return (value > 0.0) - (value < 0.0);
+}
+
+// Sign of the exact sum of the terms: each term is grown into a nonoverlapping expansion
+// (Shewchuk's Grow-Expansion with zero elimination), whose last component is the largest
+int ExactSumSign(const double* terms, int termCount) {
+    double expansion[8];
+    int length = 0;
+    for (int t = 0; t < termCount; ++t) {
+        double carry = terms[t];
+        int kept = 0;
+        for (int k = 0; k < length; ++k) {
+            double error;
+            TwoSum(carry, expansion[k], &carry, &error);
+            if (error != 0.0) expansion[kept++] = error;
+        }
+        if (carry != 0.0) expansion[kept++] = carry;
+        length = kept;
+    }
+    return (length == 0) ? 0 : Sign(expansion[length - 1]);
+}
+
+} // namespace
+
+// --- main functions ---
+
+int Orient2dSign(const SPointNE& p, const SPointNE& q, const SPointNE& r) {
+    PREDICATE_COUNT(EPredicateCounterID::OrientQueries);
+
+    const double detLeft = ((double)q.east - p.east) * ((double)r.north - q.north);
+    const double detRight = ((double)q.north - p.north) * ((double)r.east - q.east);
+    const double det = detLeft - detRight;
+
+    // Terms of opposite signs (or a zero one) cannot cancel: the rounded sign is exact
+    double detSum;
+    if (detLeft > 0.0) {
+        if (detRight <= 0.0) return Sign(det);
+        detSum = detLeft + detRight;
+    }
+    else if (detLeft < 0.0) {
+        if (detRight >= 0.0) return Sign(det);
+        detSum = -detLeft - detRight;
+    }
+    else {
+        return Sign(det);
+    }
+
+    const double errorBound = ORIENT_ERROR_BOUND * detSum;
+    if (det >= errorBound || -det >= errorBound) return Sign(det);
+    if (!std::isfinite(detSum)) return 0;
+
+    // Inconclusive: det = qe*rn - pe*rn + pe*qn - qn*re + pn*re - pn*qe, every float product exact in double
+    PREDICATE_COUNT(EPredicateCounterID::OrientExactFallbacks);
+    const double pn = p.north, pe = p.east, qn = q.north, qe = q.east, rn = r.north, re = r.east;
+    const double terms[6] = { qe * rn, -(pe * rn), pe * qn, -(qn * re), pn * re, -(pn * qe) };
+    return ExactSumSign(terms, 6);
+}
@@ -0,0 +1,46 @@
+#include "scratch_arena.h"
+
+// --- helper functions ---
+
+namespace {
+
+inline bool IsPowerOfTwo(uint32_t value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+} // namespace
+
+// --- main functions ---
+
+EResultState InitArena(SArena& arena, uint8_t* buffer, uint32_t capacity) {
+    arena.base = buffer;
+    arena.capacity = capacity;
+    arena.used = 0;
+    arena.highWater = 0;
+    return EResultState::OK;
+}
+
+
+EResultState ArenaReserve(SArena& arena, uint64_t sizeBytes, uint32_t alignment, uint32_t* outOffset) {
+    if (!IsPowerOfTwo(alignment) || alignment > ARENA_MAX_ALIGNMENT) return EResultState::BUFFER_NOT_ALIGNED;
+
+    // Align the address rather than the offset, so any buffer works; a measuring arena has base 0
+    const uint64_t address = (uint64_t)reinterpret_cast<uintptr_t>(arena.base);
+    const uint64_t start = ((address + arena.used + alignment - 1) & ~(uint64_t)(alignment - 1)) - address;
+    if (start + sizeBytes > arena.capacity) return EResultState::BUFFER_TOO_SMALL;
+
+    *outOffset = (uint32_t)start;
+    arena.used = (uint32_t)(start + sizeBytes);
+    if (arena.used > arena.highWater) {
+        arena.highWater = arena.used;
+    }
+    return EResultState::OK;
+}
+
+
+EResultState ArenaRewindTo(SArena& arena, uint32_t mark) {
+    if (mark > arena.used) return EResultState::ARENA_MARK_INVALID;
+
+    arena.used = mark;
+    return EResultState::OK;
+}
@@ -0,0 +1,212 @@
+#include "worker_pool.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <new>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+// --- helper functions ---
+
+namespace {
+
+#if defined(_WIN32)
+typedef HANDLE TThreadHandle;
+#else
+typedef pthread_t TThreadHandle;
+#endif
+
+struct SWorkerPool;
+
+struct SWorkerSlot {
+    SWorkerPool* pool;
+    uint32_t worker;
+};
+
+struct SWorkerPool {
+    uint32_t magic;
+    uint32_t threadCount;
+
+    std::mutex runMutex;     // serializes RunOnWorkerPool callers
+    std::mutex mutex;        // guards everything below
+    std::condition_variable wake;
+    std::condition_variable done;
+    uint64_t generation;
+    uint32_t running;
+    bool stop;
+    TWorkerBody body;
+    void* context;
+
+    TThreadHandle threads[WORKER_POOL_MAX_THREADS];
+    SWorkerSlot slots[WORKER_POOL_MAX_THREADS];
+};
+
+inline SWorkerPool* AsPool(uint8_t* pool) {
+    return reinterpret_cast<SWorkerPool*>(pool);
+}
+
+void WorkerLoop(SWorkerSlot& slot) {
+    SWorkerPool& pool = *slot.pool;
+    uint64_t seen = 0;
+
+    for (;;) {
+        TWorkerBody body;
+        void* context;
+        {
+            std::unique_lock<std::mutex> lock(pool.mutex);
+            pool.wake.wait(lock, [&pool, seen]() { return pool.stop || pool.generation != seen; });
+            if (pool.stop) {
+                return;
+            }
+            seen = pool.generation;
+            body = pool.body;
+            context = pool.context;
+        }
+
+        body(context, slot.worker, pool.threadCount);
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (--pool.running == 0) {
+            pool.done.notify_one();
+        }
+    }
+}
+
+#if defined(_WIN32)
+DWORD WINAPI ThreadEntry(LPVOID param) {
+    WorkerLoop(*static_cast<SWorkerSlot*>(param));
+    return 0;
+}
+
+bool StartThread(TThreadHandle* handle, SWorkerSlot* slot) {
+    *handle = CreateThread(nullptr, 0, ThreadEntry, slot, 0, nullptr);
+    return *handle != nullptr;
+}
+
+void JoinThread(TThreadHandle handle) {
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+}
+#else
+void* ThreadEntry(void* param) {
+    WorkerLoop(*static_cast<SWorkerSlot*>(param));
+    return nullptr;
+}
+
+bool StartThread(TThreadHandle* handle, SWorkerSlot* slot) {
+    return pthread_create(handle, nullptr, ThreadEntry, slot) == 0;
+}
+
+void JoinThread(TThreadHandle handle) {
+    pthread_join(handle, nullptr);
+}
+#endif
+
+// Stops and joins threads 1 .. startedCount - 1 and destroys the pool
+void StopPool(SWorkerPool* pool, uint32_t startedCount) {
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->stop = true;
+    }
+    pool->wake.notify_all();
+    for (uint32_t t = 1; t < startedCount; ++t) {
+        JoinThread(pool->threads[t]);
+    }
+
+    pool->magic = 0;
+    pool->~SWorkerPool();
+}
+
+} // namespace
+
+// --- main functions ---
+
+uint32_t WorkerPoolSize() {
+    return (uint32_t)sizeof(SWorkerPool);
+}
+
+
+EResultState InitWorkerPool(uint8_t* buffer, uint32_t bufferSize, uint32_t threadCount) {
+    if (buffer == nullptr) return EResultState::BUFFER_IS_NULL_PTR;
+    if (reinterpret_cast<uintptr_t>(buffer) % alignof(SWorkerPool) != 0) return EResultState::BUFFER_NOT_ALIGNED;
+    if (bufferSize < sizeof(SWorkerPool)) return EResultState::BUFFER_TOO_SMALL;
+    // Constructing over a live pool would orphan its running threads
+    if (WorkerPoolThreadCount(buffer) != 0) return EResultState::POOL_ALREADY_STARTED;
+    if (threadCount < 1 || threadCount > WORKER_POOL_MAX_THREADS) return EResultState::THREAD_COUNT_INVALID;
+
+    // Placement construction into caller memory, no heap involved
+    SWorkerPool* pool = new (buffer) SWorkerPool();
+    pool->threadCount = threadCount;
+    pool->generation = 0;
+    pool->running = 0;
+    pool->stop = false;
+    pool->body = nullptr;
+    pool->context = nullptr;
+
+    for (uint32_t t = 1; t < threadCount; ++t) {
+        pool->slots[t] = { pool, t };
+        if (!StartThread(&pool->threads[t], &pool->slots[t])) {
+            StopPool(pool, t);
+            return EResultState::THREAD_START_FAILED;
+        }
+    }
+
+    pool->magic = WORKER_POOL_MAGIC;
+    return EResultState::OK;
+}
+
+
+EResultState ShutdownWorkerPool(uint8_t* pool) {
+    if (pool == nullptr) return EResultState::BUFFER_IS_NULL_PTR;
+    if (WorkerPoolThreadCount(pool) == 0) return EResultState::PREPARED_DATA_INVALID;
+
+    StopPool(AsPool(pool), AsPool(pool)->threadCount);
+    return EResultState::OK;
+}
+
+
+uint32_t WorkerPoolThreadCount(const uint8_t* pool) {
+    if (pool == nullptr || reinterpret_cast<uintptr_t>(pool) % alignof(SWorkerPool) != 0) return 0;
+
+    const SWorkerPool* workerPool = reinterpret_cast<const SWorkerPool*>(pool);
+    return (workerPool->magic == WORKER_POOL_MAGIC) ? workerPool->threadCount : 0;
+}
+
+
+void RunOnWorkerPool(uint8_t* pool, TWorkerBody body, void* context) {
+    SWorkerPool& workerPool = *AsPool(pool);
+    std::lock_guard<std::mutex> runLock(workerPool.runMutex);
+
+    if (workerPool.threadCount > 1) {
+        {
+            std::lock_guard<std::mutex> lock(workerPool.mutex);
+            workerPool.body = body;
+            workerPool.context = context;
+            workerPool.running = workerPool.threadCount - 1;
+            workerPool.generation++;
+        }
+        workerPool.wake.notify_all();
+    }
+
+    body(context, 0, workerPool.threadCount);
+
+    if (workerPool.threadCount > 1) {
+        std::unique_lock<std::mutex> lock(workerPool.mutex);
+        workerPool.done.wait(lock, [&workerPool]() { return workerPool.running == 0; });
+    }
+}
+
+
+void PartitionRange(uint32_t itemCount, uint32_t granule, uint32_t worker, uint32_t workerCount, uint32_t* outBegin, uint32_t* outEnd) {
+    const uint64_t granuleCount = ((uint64_t)itemCount + granule - 1) / granule;
+    const uint64_t perWorker = (granuleCount + workerCount - 1) / workerCount;
+    const uint64_t begin = (uint64_t)worker * perWorker * granule;
+    const uint64_t end = begin + perWorker * granule;
+
+    *outBegin = (uint32_t)((begin < itemCount) ? begin : itemCount);
+    *outEnd = (uint32_t)((end < itemCount) ? end : itemCount);
+}
@@ -0,0 +1,288 @@
+#include "zone_index.h"
+#include "api_functions.h"
+#include "geometric_functions.h"
+#include "polygon_ray.h"
+#include "scratch_arena.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// --- helper functions ---
+
+namespace {
+
+inline SZoneIndexNode* Nodes(uint8_t* buffer, const SZoneIndexHeader& header) {
+    return reinterpret_cast<SZoneIndexNode*>(buffer + header.nodesOffset);
+}
+
+inline const SZoneIndexNode* Nodes(const SZoneIndexHeader* index) {
+    return reinterpret_cast<const SZoneIndexNode*>(reinterpret_cast<const uint8_t*>(index) + index->nodesOffset);
+}
+
+inline const SZoneRecord* Zones(const SZoneIndexHeader* index) {
+    return reinterpret_cast<const SZoneRecord*>(reinterpret_cast<const uint8_t*>(index) + index->zonesOffset);
+}
+
+inline const SPointNE* Vertices(const SZoneIndexHeader* index) {
+    return reinterpret_cast<const SPointNE*>(reinterpret_cast<const uint8_t*>(index) + index->verticesOffset);
+}
+
+// Written so that a NaN query box overlaps everything (the query then degrades to a full scan).
+inline bool BoundsOverlap(const SZoneBounds& box, double loNorth, double loEast, double hiNorth, double hiEast) {
+    return !(hiNorth < box.minNorth || loNorth > box.maxNorth || hiEast < box.minEast || loEast > box.maxEast);
+}
+
+inline void GrowBounds(SZoneBounds& box, const SZoneBounds& other) {
+    box.minNorth = MIN(box.minNorth, other.minNorth);
+    box.minEast = MIN(box.minEast, other.minEast);
+    box.maxNorth = MAX(box.maxNorth, other.maxNorth);
+    box.maxEast = MAX(box.maxEast, other.maxEast);
+}
+
+// Nodes of the tree BuildNode makes over count zones (halving split, ZONE_INDEX_LEAF_SIZE per leaf).
+uint64_t NodeCountFor(uint32_t count) {
+    if (count <= ZONE_INDEX_LEAF_SIZE) return 1;
+    return 1 + NodeCountFor(count / 2) + NodeCountFor(count - count / 2);
+}
+
+// Lays the sections out in arena (buffer order) and fills the header offsets and total size.
+// Fails with BUFFER_TOO_SMALL when they do not fit the arena.
+EResultState ComputeZoneIndexLayout(const uint16_t* zonePointCounts, SZoneIndexHeader& header, SArena& arena) {
+    uint64_t vertexCount = 0;
+    for (uint32_t z = 0; z < header.zoneCount; ++z) {
+        vertexCount += zonePointCounts[z];
+    }
+    const uint64_t nodeCount = (header.zoneCount > 0) ? NodeCountFor(header.zoneCount) : 0;
+    if (vertexCount > UINT32_MAX) return EResultState::BUFFER_TOO_SMALL;
+    header.nodeCount = (uint32_t)nodeCount;
+    header.vertexCount = (uint32_t)vertexCount;
+
+    uint32_t headerOffset = 0;
+    uint32_t endOffset = 0;
+    EResultState state = ArenaReserve(arena, sizeof(SZoneIndexHeader), ARENA_DEFAULT_ALIGNMENT, &headerOffset);
+    if (state == EResultState::OK) state = ArenaReserve(arena, nodeCount * sizeof(SZoneIndexNode), ARENA_DEFAULT_ALIGNMENT, &header.nodesOffset);
+    if (state == EResultState::OK) state = ArenaReserve(arena, (uint64_t)header.zoneCount * sizeof(SZoneRecord), ARENA_DEFAULT_ALIGNMENT, &header.zonesOffset);
+    if (state == EResultState::OK) state = ArenaReserve(arena, vertexCount * sizeof(SPointNE), ARENA_DEFAULT_ALIGNMENT, &header.verticesOffset);
+    // Pad the end so indices stored back to back stay aligned
+    if (state == EResultState::OK) state = ArenaReserve(arena, 0, ARENA_DEFAULT_ALIGNMENT, &endOffset);
+
+    header.totalSize = endOffset;
+    return state;
+}
+
+// Builds the subtree over zones[0, count) at nodes[nodeIndex]; returns the next free node index.
+// Zones are split at the median box center along the wider axis of the node.
+uint32_t BuildNode(SZoneIndexNode* nodes, uint32_t nodeIndex, SZoneRecord* zones, uint32_t first, uint32_t count) {
+    SZoneIndexNode& node = nodes[nodeIndex];
+    node.bounds = zones[first].bounds;
+    for (uint32_t z = first + 1; z < first + count; ++z) {
+        GrowBounds(node.bounds, zones[z].bounds);
+    }
+
+    if (count <= ZONE_INDEX_LEAF_SIZE) {
+        node.first = first;
+        node.count = count;
+        return nodeIndex + 1;
+    }
+
+    const bool splitNorth = (node.bounds.maxNorth - node.bounds.minNorth) >= (node.bounds.maxEast - node.bounds.minEast);
+    const uint32_t half = count / 2;
+    std::nth_element(zones + first, zones + first + half, zones + first + count,
+        [splitNorth](const SZoneRecord& a, const SZoneRecord& b) {
+            return splitNorth
+                ? (a.bounds.minNorth + a.bounds.maxNorth) < (b.bounds.minNorth + b.bounds.maxNorth)
+                : (a.bounds.minEast + a.bounds.maxEast) < (b.bounds.minEast + b.bounds.maxEast);
+        });
+
+    const uint32_t rightIndex = BuildNode(nodes, nodeIndex + 1, zones, first, half);
+    node.first = rightIndex;
+    node.count = 0;
+    return BuildNode(nodes, rightIndex, zones, first + half, count - half);
+}
+
+// Calls visit(zone) for every zone whose box overlaps the query box, left subtree first.
+template <typename TVisitor>
+void ForEachCandidateZone(const SZoneIndexHeader* index, double loNorth, double loEast, double hiNorth, double hiEast, TVisitor visit) {
+    if (index->nodeCount == 0) {
+        return;
+    }
+
+    const SZoneIndexNode* nodes = Nodes(index);
+    const SZoneRecord* zones = Zones(index);
+
+    uint32_t stack[ZONE_INDEX_MAX_DEPTH];
+    uint32_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        const uint32_t nodeIndex = stack[--stackSize];
+        const SZoneIndexNode& node = nodes[nodeIndex];
+        if (!BoundsOverlap(node.bounds, loNorth, loEast, hiNorth, hiEast)) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            for (uint32_t z = node.first; z < node.first + node.count; ++z) {
+                if (BoundsOverlap(zones[z].bounds, loNorth, loEast, hiNorth, hiEast)) {
+                    visit(zones[z]);
+                }
+            }
+        }
+        else {
+            stack[stackSize++] = node.first;
+            stack[stackSize++] = nodeIndex + 1;
+        }
+    }
+}
+
+// Query box half-size around the query, so every zone the exact test could flag is visited
+inline double QueryReach(const SZoneIndexHeader* index, float radiusMeters, float queryMaxCoord) {
+    return std::fabs((double)radiusMeters) + getSearchMargin(MAX(index->maxAbsCoord, queryMaxCoord));
+}
+
+} // namespace
+
+// --- main functions ---
+
+EResultState GetZoneIndexSize(const uint16_t* zonePointCounts, uint32_t zoneCount, uint32_t* outSizeBytes) {
+    *outSizeBytes = 0;
+
+    if (zonePointCounts == nullptr && zoneCount > 0) return EResultState::POLYGON_IS_NULL_PTR;
+
+    // Measuring arena: the whole 32-bit range, no memory
+    SArena arena;
+    InitArena(arena, nullptr, UINT32_MAX);
+    SZoneIndexHeader header = {};
+    header.zoneCount = zoneCount;
+    if (ComputeZoneIndexLayout(zonePointCounts, header, arena) != EResultState::OK) return EResultState::INDEX_TOO_LARGE;
+
+    *outSizeBytes = header.totalSize;
+    return EResultState::OK;
+}
+
+
+EResultState PrepareZoneIndex(const SPointNE* zonePoints, const uint16_t* zonePointCounts, const uint32_t* zoneIds, uint32_t zoneCount, uint8_t* buffer, uint32_t bufferSize) {
+    if ((zonePoints == nullptr || zonePointCounts == nullptr) && zoneCount > 0) return EResultState::POLYGON_IS_NULL_PTR;
+    for (uint32_t z = 0; z < zoneCount; ++z) {
+        if (zonePointCounts[z] < 3) return EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+    }
+    if (buffer == nullptr) return EResultState::BUFFER_IS_NULL_PTR;
+    if (reinterpret_cast<uintptr_t>(buffer) % 8 != 0) return EResultState::BUFFER_NOT_ALIGNED;
+
+    SArena arena;
+    InitArena(arena, nullptr, UINT32_MAX);
+    SZoneIndexHeader header = {};
+    header.magic = ZONE_INDEX_MAGIC;
+    header.zoneCount = zoneCount;
+    if (ComputeZoneIndexLayout(zonePointCounts, header, arena) != EResultState::OK) return EResultState::INDEX_TOO_LARGE;
+    if (header.totalSize > bufferSize) return EResultState::BUFFER_TOO_SMALL;
+
+    std::memset(buffer, 0, (size_t)header.totalSize);
+    std::memcpy(buffer + header.verticesOffset, zonePoints, (size_t)header.vertexCount * sizeof(SPointNE));
+
+    // 1. One record per zone with its bounding box
+    SZoneRecord* zones = reinterpret_cast<SZoneRecord*>(buffer + header.zonesOffset);
+    uint32_t firstVertex = 0;
+    header.maxAbsCoord = 0.0f;
+    for (uint32_t z = 0; z < zoneCount; ++z) {
+        const SPointNE* polygon = zonePoints + firstVertex;
+        SZoneRecord& zone = zones[z];
+        zone.zoneId = (zoneIds != nullptr) ? zoneIds[z] : z;
+        zone.firstVertex = firstVertex;
+        zone.pointCount = zonePointCounts[z];
+
+        zone.bounds = { polygon[0].north, polygon[0].east, polygon[0].north, polygon[0].east };
+        for (uint16_t i = 0; i < zone.pointCount; ++i) {
+            zone.bounds.minNorth = MIN(zone.bounds.minNorth, polygon[i].north);
+            zone.bounds.maxNorth = MAX(zone.bounds.maxNorth, polygon[i].north);
+            zone.bounds.minEast = MIN(zone.bounds.minEast, polygon[i].east);
+            zone.bounds.maxEast = MAX(zone.bounds.maxEast, polygon[i].east);
+            header.maxAbsCoord = MAX(header.maxAbsCoord, MAX(std::fabs(polygon[i].north), std::fabs(polygon[i].east)));
+        }
+        firstVertex += zone.pointCount;
+    }
+
+    // 2. Hierarchy over the records (reorders them in place)
+    if (zoneCount > 0) {
+        BuildNode(Nodes(buffer, header), 0, zones, 0, zoneCount);
+    }
+
+    std::memcpy(buffer, &header, sizeof(header));
+    return EResultState::OK;
+}
+
+
+const SZoneIndexHeader* GetZoneIndexHeader(const uint8_t* prepared, EResultState* outState) {
+    if (prepared == nullptr) {
+        *outState = EResultState::BUFFER_IS_NULL_PTR;
+        return nullptr;
+    }
+    if (reinterpret_cast<uintptr_t>(prepared) % 8 != 0) {
+        *outState = EResultState::BUFFER_NOT_ALIGNED;
+        return nullptr;
+    }
+
+    const SZoneIndexHeader* index = reinterpret_cast<const SZoneIndexHeader*>(prepared);
+    if (index->magic != ZONE_INDEX_MAGIC) {
+        *outState = EResultState::PREPARED_DATA_INVALID;
+        return nullptr;
+    }
+
+    *outState = EResultState::OK;
+    return index;
+}
+
+
+uint32_t QueryZonesCircleIndexed(const SZoneIndexHeader* index, const SPointNE& testPoint, float radiusMeters, uint32_t* outZoneIds, uint32_t maxZoneIds) {
+    const SPointNE* vertices = Vertices(index);
+    const double reach = QueryReach(index, radiusMeters, MAX(std::fabs(testPoint.north), std::fabs(testPoint.east)));
+
+    uint32_t hitCount = 0;
+    ForEachCandidateZone(index, testPoint.north - reach, testPoint.east - reach, testPoint.north + reach, testPoint.east + reach,
+        [&](const SZoneRecord& zone) {
+            uint8_t result = false;
+            uint8_t state = EResultState::OK;
+            isInsidePolygon(vertices + zone.firstVertex, zone.pointCount, testPoint, radiusMeters, &result, &state);
+            if (result) {
+                if (hitCount < maxZoneIds) outZoneIds[hitCount] = zone.zoneId;
+                hitCount++;
+            }
+        });
+
+    return hitCount;
+}
+
+
+uint32_t QueryZonesSegmentIndexed(const SZoneIndexHeader* index, const SPointNE& testPoint, float azimuthDegrees, float maxLength, uint32_t* outZoneIds, uint32_t maxZoneIds) {
+    const SPointNE* vertices = Vertices(index);
+
+    const SPointNE endPoint = GetRayEndPoint(SRayNE{ testPoint, azimuthDegrees, maxLength });
+
+    const float queryMaxCoord = MAX(MAX(std::fabs(testPoint.north), std::fabs(testPoint.east)), MAX(std::fabs(endPoint.north), std::fabs(endPoint.east)));
+    const double reach = QueryReach(index, 0.0f, queryMaxCoord);
+
+    double loNorth = MIN(testPoint.north, endPoint.north) - reach;
+    double loEast = MIN(testPoint.east, endPoint.east) - reach;
+    double hiNorth = MAX(testPoint.north, endPoint.north) + reach;
+    double hiEast = MAX(testPoint.east, endPoint.east) + reach;
+    // MIN/MAX may drop a NaN: visit every zone for non-finite segments
+    if (!std::isfinite(queryMaxCoord)) {
+        loNorth = loEast = -INFINITY;
+        hiNorth = hiEast = INFINITY;
+    }
+
+    uint32_t hitCount = 0;
+    ForEachCandidateZone(index, loNorth, loEast, hiNorth, hiEast,
+        [&](const SZoneRecord& zone) {
+            uint8_t result = false;
+            uint8_t state = EResultState::OK;
+            doesLineIntersectPolygon(vertices + zone.firstVertex, zone.pointCount, testPoint, azimuthDegrees, maxLength, &result, &state);
+            if (result) {
+                if (hitCount < maxZoneIds) outZoneIds[hitCount] = zone.zoneId;
+                hitCount++;
+            }
+        });
+
+    return hitCount;
+}
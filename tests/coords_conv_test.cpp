@@ -0,0 +1,572 @@
+#include "api_functions.h"
+#include "coords_conv_functions.h"
+
+#include <iostream>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// --- Mini Test Framework ---
+int g_tests_passed = 0;
+int g_tests_failed = 0;
+
+void Check(const char* testName, bool passed, double maxError, double bound) {
+    if (passed) {
+        std::cout << "[PASS] " << testName << " | max error: " << maxError << " (bound " << bound << ")" << std::endl;
+        g_tests_passed++;
+    }
+    else {
+        std::cout << "[FAIL] " << testName << " | max error: " << maxError << " exceeds bound " << bound << std::endl;
+        g_tests_failed++;
+    }
+}
+
+// --- Test Grid ---
+// Global lat/lon grid, one latitude row at a time (no heap in the test either).
+const int LON_STEPS = 181;          // -180..180 every 2 deg
+const double LON_STEP_DEG = 2.0;
+const double GRID_ALTITUDES[] = { -1000.0, 0.0, 500.0, 10000.0, 100000.0 };
+
+// Bounds documented in coords_conv_kernels.h
+const double ECEF_BOUND_M = 1e-8;
+const double ANGLE_BOUND_DEG = 1e-12;
+const double ALTITUDE_BOUND_M = 1e-8;
+
+const char* KernelName(uint8_t kernel) {
+    switch (kernel) {
+    case ECoordsKernel::KERNEL_SCALAR: return "Scalar";
+    case ECoordsKernel::KERNEL_AVX2: return "AVX2";
+    case ECoordsKernel::KERNEL_AVX512: return "AVX-512";
+    default: return "Auto";
+    }
+}
+
+double AngleDiffDeg(double a, double b) {
+    double d = std::fabs(a - b);
+    return (d > 180.0) ? 360.0 - d : d;
+}
+
+// --- Tests ---
+
+void test_kernel_vs_reference(uint8_t kernel) {
+    SPointGeo geoRow[LON_STEPS];
+    SPointECEF refEcef[LON_STEPS];
+    SPointECEF kerEcef[LON_STEPS];
+    SPointGeo refGeo[LON_STEPS];
+    SPointGeo kerGeo[LON_STEPS];
+
+    SPointGeo probe = { 0.0, 0.0, 0.0 };
+    SPointECEF probeOut;
+    uint8_t state = EResultState::OK;
+    GeoToEcefArray(&probe, 1, &probeOut, kernel, &state);
+    if (state == EResultState::KERNEL_NOT_SUPPORTED) {
+        std::cout << "[SKIP] " << KernelName(kernel) << " kernel not supported on this CPU" << std::endl;
+        return;
+    }
+
+    double maxEcefErr = 0.0;
+    double maxAngleErr = 0.0;
+    double maxAltErr = 0.0;
+    bool statesOk = true;
+
+    for (double altitude : GRID_ALTITUDES) {
+        for (int latDeg = -90; latDeg <= 90; ++latDeg) {
+            for (int k = 0; k < LON_STEPS; ++k) {
+                geoRow[k] = { (double)latDeg, -180.0 + k * LON_STEP_DEG, altitude };
+            }
+
+            uint8_t s1, s2, s3, s4;
+            GeoToEcefArray(geoRow, LON_STEPS, refEcef, ECoordsKernel::KERNEL_REFERENCE, &s1);
+            GeoToEcefArray(geoRow, LON_STEPS, kerEcef, kernel, &s2);
+            EcefToGeoArray(refEcef, LON_STEPS, refGeo, ECoordsKernel::KERNEL_REFERENCE, &s3);
+            EcefToGeoArray(refEcef, LON_STEPS, kerGeo, kernel, &s4);
+            statesOk = statesOk && s1 == EResultState::OK && s2 == EResultState::OK && s3 == EResultState::OK && s4 == EResultState::OK;
+
+            for (int k = 0; k < LON_STEPS; ++k) {
+                maxEcefErr = std::fmax(maxEcefErr, std::fabs(refEcef[k].x - kerEcef[k].x));
+                maxEcefErr = std::fmax(maxEcefErr, std::fabs(refEcef[k].y - kerEcef[k].y));
+                maxEcefErr = std::fmax(maxEcefErr, std::fabs(refEcef[k].z - kerEcef[k].z));
+
+                maxAngleErr = std::fmax(maxAngleErr, std::fabs(refGeo[k].latitudeDeg - kerGeo[k].latitudeDeg));
+                // Longitude is undefined on the poles
+                if (std::abs(latDeg) != 90) {
+                    maxAngleErr = std::fmax(maxAngleErr, AngleDiffDeg(refGeo[k].longitudeDeg, kerGeo[k].longitudeDeg));
+                }
+                maxAltErr = std::fmax(maxAltErr, std::fabs(refGeo[k].altitude - kerGeo[k].altitude));
+            }
+        }
+    }
+
+    std::cout << "\n--- Testing " << KernelName(kernel) << " kernel vs reference ---\n";
+    Check("Result State OK", statesOk, 0.0, 0.0);
+    Check("GeoToEcef [m]", maxEcefErr <= ECEF_BOUND_M, maxEcefErr, ECEF_BOUND_M);
+    Check("EcefToGeo lat/lon [deg]", maxAngleErr <= ANGLE_BOUND_DEG, maxAngleErr, ANGLE_BOUND_DEG);
+    Check("EcefToGeo altitude [m]", maxAltErr <= ALTITUDE_BOUND_M, maxAltErr, ALTITUDE_BOUND_M);
+}
+
+void test_batch_vs_single() {
+    std::cout << "\n--- Testing GeoToNedBatch / NedToGeoBatch vs single point ---\n";
+
+    const double originLat = 32.1, originLon = 34.8, originAlt = 50.0;
+    const int count = 100;
+    SPointGeo geo[count];
+    SPointNED ned[count];
+    SPointGeo geoBack[count];
+
+    for (int i = 0; i < count; ++i) {
+        geo[i] = { originLat + (i - 50) * 0.003, originLon - (i - 50) * 0.004, 10.0 * i };
+    }
+
+    uint8_t state;
+    GeoToNedBatch(originLat, originLon, originAlt, geo, count, 0, ned, 0, &state);
+    NedToGeoBatch(originLat, originLon, originAlt, ned, count, 0, geoBack, 0, &state);
+
+    // The batches run the reference conversions, so each point is bit-identical to the single call
+    bool nedSame = true;
+    bool geoSame = true;
+    for (int i = 0; i < count; ++i) {
+        SPointNED single;
+        GeoToNed(originLat, originLon, originAlt, geo[i], &single);
+        nedSame = nedSame && std::memcmp(&single, &ned[i], sizeof(SPointNED)) == 0;
+
+        SPointGeo singleGeo;
+        NedToGeo(originLat, originLon, originAlt, ned[i], &singleGeo);
+        geoSame = geoSame && std::memcmp(&singleGeo, &geoBack[i], sizeof(SPointGeo)) == 0;
+    }
+
+    Check("GeoToNedBatch == GeoToNed (bitwise)", nedSame, 0.0, 0.0);
+    Check("NedToGeoBatch == NedToGeo (bitwise)", geoSame, 0.0, 0.0);
+
+    // Padded records in and out (stride > sizeof): same results, padding left untouched
+    struct SGeoRecord { uint32_t id; SPointGeo geo; double speed; };
+    struct SNedRecord { SPointNED ned; uint64_t flags; };
+    SGeoRecord geoRecords[count];
+    SNedRecord nedRecords[count];
+    SGeoRecord backRecords[count];
+    for (int i = 0; i < count; ++i) {
+        geoRecords[i] = { (uint32_t)i, geo[i], 1.5 * i };
+        nedRecords[i].flags = 0xA5A5A5A5A5A5A5A5ull;
+        backRecords[i].id = 0xFFFFFFFF;
+    }
+
+    uint8_t s1, s2;
+    GeoToNedBatch(originLat, originLon, originAlt, &geoRecords[0].geo, count, sizeof(SGeoRecord), &nedRecords[0].ned, sizeof(SNedRecord), &s1);
+    NedToGeoBatch(originLat, originLon, originAlt, &nedRecords[0].ned, count, sizeof(SNedRecord), &backRecords[0].geo, sizeof(SGeoRecord), &s2);
+
+    bool stridedSame = s1 == EResultState::OK && s2 == EResultState::OK;
+    for (int i = 0; i < count; ++i) {
+        stridedSame = stridedSame && std::memcmp(&nedRecords[i].ned, &ned[i], sizeof(SPointNED)) == 0 &&
+            std::memcmp(&backRecords[i].geo, &geoBack[i], sizeof(SPointGeo)) == 0 &&
+            nedRecords[i].flags == 0xA5A5A5A5A5A5A5A5ull && backRecords[i].id == 0xFFFFFFFF;
+    }
+    Check("Strided Records == Packed", stridedSame, 0.0, 0.0);
+
+    GeoToNedBatch(originLat, originLon, originAlt, nullptr, count, 0, ned, 0, &state);
+    Check("Null Points Check", state == EResultState::POINTS_IS_NULL_PTR, 0.0, 0.0);
+
+    // A nonzero stride below the record size would overlap the records
+    GeoToNedBatch(originLat, originLon, originAlt, geo, count, sizeof(SPointGeo) - 8, ned, 0, &s1);
+    NedToGeoBatch(originLat, originLon, originAlt, ned, count, 0, geoBack, 1, &s2);
+    Check("Short Stride Rejected", s1 == EResultState::STRIDE_TOO_SMALL && s2 == EResultState::STRIDE_TOO_SMALL, 0.0, 0.0);
+}
+
+void test_frame_vs_origin() {
+    std::cout << "\n--- Testing InitLocalFrame / *Frame conversions vs GeoToNed / NedToGeo ---\n";
+
+    uint32_t seed = 7;
+    auto rand01 = [&seed]() { seed = seed * 1664525u + 1013904223u; return (seed >> 8) / 16777216.0; };
+
+    // The frame caches exactly what GeoToNed / NedToGeo compute per call, so results are bit-identical
+    bool same = true;
+    bool statesOk = true;
+    for (int o = 0; o < 50; ++o) {
+        const double originLat = 180.0 * rand01() - 90.0;
+        const double originLon = 360.0 * rand01() - 180.0;
+        const double originAlt = 2000.0 * rand01() - 500.0;
+        SLocalFrame frame;
+        uint8_t s0;
+        InitLocalFrame(originLat, originLon, originAlt, &frame, &s0);
+        statesOk = statesOk && s0 == EResultState::OK;
+
+        for (int i = 0; i < 20; ++i) {
+            const SPointGeo geo = { std::fmax(-90.0, std::fmin(90.0, originLat + 0.4 * rand01() - 0.2)), originLon + 0.4 * rand01() - 0.2, 5000.0 * rand01() };
+            const SPointNED ned = { 40000.0 * rand01() - 20000.0, 40000.0 * rand01() - 20000.0, 2000.0 * rand01() - 1000.0 };
+
+            SPointNED nedOrigin, nedFrame, nedFromEcef;
+            GeoToNed(originLat, originLon, originAlt, geo, &nedOrigin);
+            uint8_t s1, s2, s3;
+            GeoToNedFrame(&frame, geo, &nedFrame, &s1);
+            EcefToNedFrame(&frame, GeoToEcef(geo), &nedFromEcef, &s2);
+
+            SPointGeo geoOrigin, geoFrame;
+            NedToGeo(originLat, originLon, originAlt, ned, &geoOrigin);
+            NedToGeoFrame(&frame, ned, &geoFrame, &s3);
+            statesOk = statesOk && s1 == EResultState::OK && s2 == EResultState::OK && s3 == EResultState::OK;
+
+            same = same && std::memcmp(&nedOrigin, &nedFrame, sizeof(SPointNED)) == 0 &&
+                std::memcmp(&nedOrigin, &nedFromEcef, sizeof(SPointNED)) == 0 &&
+                std::memcmp(&geoOrigin, &geoFrame, sizeof(SPointGeo)) == 0;
+        }
+    }
+    Check("Frame Result States OK", statesOk, 0.0, 0.0);
+    Check("Frame == Origin Conversions (bitwise)", same, 0.0, 0.0);
+
+    // Null frame and null outputs, the same states as NedToGeoFrameMethod
+    SLocalFrame frame;
+    const SPointGeo geo = { 32.1, 34.8, 50.0 };
+    const SPointNED ned = { 100.0, 200.0, -10.0 };
+    SPointNED nedOut;
+    SPointGeo geoOut;
+    uint8_t states[7];
+    InitLocalFrame(32.1, 34.8, 50.0, nullptr, &states[0]);
+    InitLocalFrame(32.1, 34.8, 50.0, &frame, &states[1]);
+    GeoToNedFrame(nullptr, geo, &nedOut, &states[2]);
+    NedToGeoFrame(nullptr, ned, &geoOut, &states[3]);
+    EcefToNedFrame(nullptr, GeoToEcef(geo), &nedOut, &states[4]);
+    GeoToNedFrame(&frame, geo, nullptr, &states[5]);
+    NedToGeoFrame(&frame, ned, nullptr, &states[6]);
+    uint8_t ecefState;
+    EcefToNedFrame(&frame, GeoToEcef(geo), nullptr, &ecefState);
+    Check("Frame Null Checks", states[0] == EResultState::BUFFER_IS_NULL_PTR && states[1] == EResultState::OK &&
+        states[2] == EResultState::BUFFER_IS_NULL_PTR && states[3] == EResultState::BUFFER_IS_NULL_PTR && states[4] == EResultState::BUFFER_IS_NULL_PTR &&
+        states[5] == EResultState::POINTS_IS_NULL_PTR && states[6] == EResultState::POINTS_IS_NULL_PTR && ecefState == EResultState::POINTS_IS_NULL_PTR, 0.0, 0.0);
+}
+
+void test_ecef_to_geo_methods() {
+    std::cout << "\n--- Testing EcefToGeoArrayMethod round trips ---\n";
+
+    const struct { uint8_t method; const char* name; double angleBound; double altitudeBound; bool withPoles; } methods[] = {
+        // Bowring degrades with altitude and on the poles (documented in coords_conv_functions.h)
+        { EEcefToGeoMethod::ECEF_TO_GEO_BOWRING, "Bowring", 1e-9, 1e-4, false },
+        { EEcefToGeoMethod::ECEF_TO_GEO_VERMEILLE, "Vermeille", 1e-12, 1e-8, true },
+        { EEcefToGeoMethod::ECEF_TO_GEO_OLSON, "Olson", 1e-12, 1e-8, true },
+    };
+
+    SPointGeo geoRow[LON_STEPS];
+    SPointECEF ecefRow[LON_STEPS];
+    SPointGeo backRow[LON_STEPS];
+
+    for (const auto& m : methods) {
+        double maxAngleErr = 0.0;
+        double maxAltErr = 0.0;
+        bool statesOk = true;
+        const int latLimit = m.withPoles ? 90 : 89;
+
+        for (double altitude : GRID_ALTITUDES) {
+            for (int latDeg = -latLimit; latDeg <= latLimit; ++latDeg) {
+                for (int k = 0; k < LON_STEPS; ++k) {
+                    geoRow[k] = { (double)latDeg, -180.0 + k * LON_STEP_DEG, altitude };
+                }
+
+                uint8_t s1, s2;
+                GeoToEcefArray(geoRow, LON_STEPS, ecefRow, ECoordsKernel::KERNEL_REFERENCE, &s1);
+                EcefToGeoArrayMethod(ecefRow, LON_STEPS, backRow, m.method, &s2);
+                statesOk = statesOk && s1 == EResultState::OK && s2 == EResultState::OK;
+
+                for (int k = 0; k < LON_STEPS; ++k) {
+                    maxAngleErr = std::fmax(maxAngleErr, std::fabs(geoRow[k].latitudeDeg - backRow[k].latitudeDeg));
+                    if (std::abs(latDeg) != 90) {
+                        maxAngleErr = std::fmax(maxAngleErr, AngleDiffDeg(geoRow[k].longitudeDeg, backRow[k].longitudeDeg));
+                    }
+                    maxAltErr = std::fmax(maxAltErr, std::fabs(geoRow[k].altitude - backRow[k].altitude));
+                }
+            }
+        }
+
+        std::cout << m.name << ":\n";
+        Check("Result State OK", statesOk, 0.0, 0.0);
+        Check("Round trip lat/lon [deg]", maxAngleErr <= m.angleBound, maxAngleErr, m.angleBound);
+        Check("Round trip altitude [m]", maxAltErr <= m.altitudeBound, maxAltErr, m.altitudeBound);
+    }
+
+    uint8_t state;
+    EcefToGeoArrayMethod(ecefRow, 1, backRow, 99, &state);
+    Check("Unknown Method Check", state == EResultState::METHOD_NOT_SUPPORTED, 0.0, 0.0);
+
+    // NedToGeoFrameMethod: the default method is NedToGeoFrame, and each method lands on the same point
+    SLocalFrame frame;
+    InitLocalFrame(32.1, 34.8, 50.0, &frame, &state);
+    const SPointNED ned = { 1500.0, -2500.0, -300.0 };
+    SPointGeo expected;
+    NedToGeoFrame(&frame, ned, &expected, &state);
+    double maxAngleErr = 0.0;
+    bool statesOk = true;
+    for (const auto& m : methods) {
+        SPointGeo geo;
+        NedToGeoFrameMethod(&frame, ned, m.method, &geo, &state);
+        statesOk = statesOk && state == EResultState::OK;
+        maxAngleErr = std::fmax(maxAngleErr, std::fmax(std::fabs(geo.latitudeDeg - expected.latitudeDeg), std::fabs(geo.longitudeDeg - expected.longitudeDeg)));
+        if (m.method == EEcefToGeoMethod::ECEF_TO_GEO_BOWRING) statesOk = statesOk && std::memcmp(&geo, &expected, sizeof(SPointGeo)) == 0;
+    }
+    Check("NedToGeoFrameMethod [deg]", statesOk && maxAngleErr <= ANGLE_BOUND_DEG, maxAngleErr, ANGLE_BOUND_DEG);
+
+    SPointGeo geo;
+    NedToGeoFrameMethod(nullptr, ned, EEcefToGeoMethod::ECEF_TO_GEO_OLSON, &geo, &state);
+    Check("Frame Method Null Frame Check", state == EResultState::BUFFER_IS_NULL_PTR, 0.0, 0.0);
+    NedToGeoFrameMethod(&frame, ned, EEcefToGeoMethod::ECEF_TO_GEO_OLSON, nullptr, &state);
+    Check("Frame Method Null Output Check", state == EResultState::POINTS_IS_NULL_PTR, 0.0, 0.0);
+    NedToGeoFrameMethod(&frame, ned, 99, &geo, &state);
+    Check("Frame Method Unknown Method Check", state == EResultState::METHOD_NOT_SUPPORTED, 0.0, 0.0);
+}
+
+void test_series_vs_exact() {
+    std::cout << "\n--- Testing GeoToNedSeriesBatch / NedToGeoSeriesBatch vs exact ---\n";
+
+    // Origins: mid latitude, near the pole, across the antimeridian, southern hemisphere
+    const SPointGeo origins[] = { { 32.1, 34.8, 50.0 }, { 89.0, 10.0, 0.0 }, { -0.5, 179.95, 3000.0 }, { -60.0, -70.0, 500.0 } };
+    const double ranges[] = { 1000.0, 20000.0, 100000.0 };
+
+    uint32_t seed = 12345;
+    auto rand01 = [&seed]() { seed = seed * 1664525u + 1013904223u; return (seed >> 8) / 16777216.0; };
+
+    bool withinBound = true;
+    double worstRatio = 0.0;
+    double maxError20km = 0.0;
+    for (const SPointGeo& origin : origins) {
+        SLocalSeriesFrame frame;
+        InitLocalSeriesFrame(origin.latitudeDeg, origin.longitudeDeg, origin.altitude, &frame);
+
+        for (double range : ranges) {
+            for (int i = 0; i < 500; ++i) {
+                SPointNED exactNed = { (2.0 * rand01() - 1.0) * range, (2.0 * rand01() - 1.0) * range, (2.0 * rand01() - 1.0) * 1000.0 };
+                SPointGeo geo;
+                NedToGeo(origin.latitudeDeg, origin.longitudeDeg, origin.altitude, exactNed, &geo);
+                GeoToNed(origin.latitudeDeg, origin.longitudeDeg, origin.altitude, geo, &exactNed);
+
+                uint8_t state;
+                double bound = 0.0, inverseBound = 0.0;
+                SPointNED ned;
+                SPointGeo geoBack;
+                GeoToNedSeriesBatch(&frame, &geo, 1, 0, &ned, 0, &bound, &state);
+                NedToGeoSeriesBatch(&frame, &exactNed, 1, 0, &geoBack, 0, &inverseBound, &state);
+
+                // Inverse error in meters: back through the exact forward conversion
+                SPointNED nedBack;
+                GeoToNed(origin.latitudeDeg, origin.longitudeDeg, origin.altitude, geoBack, &nedBack);
+                const double error = std::sqrt(std::pow(ned.north - exactNed.north, 2) + std::pow(ned.east - exactNed.east, 2) + std::pow(ned.down - exactNed.down, 2));
+                const double inverseError = std::sqrt(std::pow(nedBack.north - exactNed.north, 2) + std::pow(nedBack.east - exactNed.east, 2) + std::pow(nedBack.down - exactNed.down, 2));
+
+                if (std::isfinite(bound)) {
+                    withinBound = withinBound && error <= bound && inverseError <= inverseBound;
+                    worstRatio = std::fmax(worstRatio, std::fmax(error / bound, inverseError / inverseBound));
+                }
+                if (range == 20000.0 && origin.latitudeDeg == 32.1) {
+                    maxError20km = std::fmax(maxError20km, std::fmax(error, inverseError));
+                }
+            }
+        }
+    }
+
+    Check("Series Error Within Bound [error/bound]", withinBound, worstRatio, 1.0);
+    Check("Series 20 km Mid Latitude [m]", maxError20km <= 0.25, maxError20km, 0.25);
+
+    // Far points get an infinite bound, so callers fall back to the exact path
+    SLocalSeriesFrame frame;
+    InitLocalSeriesFrame(32.1, 34.8, 50.0, &frame);
+    SPointGeo far = { 45.0, 34.8, 0.0 };
+    SPointNED ned;
+    double bound = 0.0;
+    uint8_t state;
+    GeoToNedSeriesBatch(&frame, &far, 1, 0, &ned, 0, &bound, &state);
+    Check("Series Far Point Bound Is Infinite", std::isinf(bound), bound, INFINITY);
+
+    // Example bounds documented in coords_conv_functions.h (equatorial origin, dAlt = 0)
+    SLocalSeriesFrame equator;
+    InitLocalSeriesFrame(0.0, 0.0, 0.0, &equator);
+    const struct { double distance; double documented; } examples[] = { { 1000.0, 1.3e-5 }, { 20000.0, 0.098 }, { 100000.0, 12.3 } };
+    double worstRelative = 0.0;
+    for (const auto& example : examples) {
+        double exampleBound = 0.0;
+        GetLocalSeriesErrorBound(&equator, example.distance, 0.0, &exampleBound);
+        worstRelative = std::fmax(worstRelative, std::fabs(exampleBound - example.documented) / example.documented);
+    }
+    Check("Series Documented Bounds [relative]", worstRelative <= 0.05, worstRelative, 0.05);
+
+    GeoToNedSeriesBatch(&frame, nullptr, 1, 0, &ned, 0, &bound, &state);
+    Check("Series Null Points Check", state == EResultState::POINTS_IS_NULL_PTR, 0.0, 0.0);
+    GeoToNedSeriesBatch(nullptr, &far, 1, 0, &ned, 0, &bound, &state);
+    Check("Series Null Frame Check", state == EResultState::BUFFER_IS_NULL_PTR, 0.0, 0.0);
+    SPointGeo geo;
+    NedToGeoSeriesBatch(nullptr, &ned, 1, 0, &geo, 0, &bound, &state);
+    Check("Series Inverse Null Frame Check", state == EResultState::BUFFER_IS_NULL_PTR, 0.0, 0.0);
+    GetLocalSeriesErrorBound(nullptr, 1000.0, 0.0, &bound);
+    Check("Series Null Frame Bound Is Infinite", std::isinf(bound), bound, INFINITY);
+}
+
+// Pool storage for the parallel tests
+alignas(64) uint8_t g_pool_buffer[1 << 14];
+const uint32_t PARALLEL_COUNT = 1000; // not a multiple of the 64-point chunk
+SPointGeo g_parallel_geo[PARALLEL_COUNT];
+SPointNED g_parallel_ned[PARALLEL_COUNT];
+SPointNED g_serial_ned[PARALLEL_COUNT];
+SPointGeo g_parallel_back[PARALLEL_COUNT];
+SPointGeo g_serial_back[PARALLEL_COUNT];
+
+void test_parallel_batch() {
+    std::cout << "\n--- Testing GeoToNedBatchParallel / NedToGeoBatchParallel vs serial ---\n";
+
+    const double originLat = 32.1, originLon = 34.8, originAlt = 50.0;
+    for (uint32_t i = 0; i < PARALLEL_COUNT; ++i) {
+        g_parallel_geo[i] = { originLat + (i % 100 - 50) * 0.003, originLon - (i % 70 - 35) * 0.004, 3.0 * i };
+    }
+
+    uint8_t state;
+    GeoToNedBatch(originLat, originLon, originAlt, g_parallel_geo, PARALLEL_COUNT, 0, g_serial_ned, 0, &state);
+    NedToGeoBatch(originLat, originLon, originAlt, g_serial_ned, PARALLEL_COUNT, 0, g_serial_back, 0, &state);
+
+    uint32_t poolSize = 0;
+    GetWorkerPoolSize(&poolSize, &state);
+    Check("Worker Pool Fits Test Buffer", poolSize <= sizeof(g_pool_buffer), poolSize, sizeof(g_pool_buffer));
+
+    // Bit-identical output for every thread count
+    const uint32_t threadCounts[] = { 1, 2, 3, 8 };
+    for (uint32_t threads : threadCounts) {
+        WorkerPoolInit(g_pool_buffer, sizeof(g_pool_buffer), threads, &state);
+        bool identical = (state == EResultState::OK);
+
+        GeoToNedBatchParallel(g_pool_buffer, originLat, originLon, originAlt, g_parallel_geo, PARALLEL_COUNT, 0, g_parallel_ned, 0, &state);
+        identical = identical && state == EResultState::OK && std::memcmp(g_parallel_ned, g_serial_ned, sizeof(g_serial_ned)) == 0;
+        NedToGeoBatchParallel(g_pool_buffer, originLat, originLon, originAlt, g_serial_ned, PARALLEL_COUNT, 0, g_parallel_back, 0, &state);
+        identical = identical && state == EResultState::OK && std::memcmp(g_parallel_back, g_serial_back, sizeof(g_serial_back)) == 0;
+
+        GeoToNedBatchParallel(g_pool_buffer, originLat, originLon, originAlt, nullptr, PARALLEL_COUNT, 0, g_parallel_ned, 0, &state);
+        identical = identical && state == EResultState::POINTS_IS_NULL_PTR;
+
+        WorkerPoolShutdown(g_pool_buffer, &state);
+        identical = identical && state == EResultState::OK;
+
+        std::cout << "[" << (identical ? "PASS" : "FAIL") << "] Parallel Batch x" << threads << " threads" << std::endl;
+        identical ? g_tests_passed++ : g_tests_failed++;
+    }
+
+    // Re-initializing a live pool is refused and leaves it running
+    uint8_t reinitState, runState, shutdownState, restartState;
+    WorkerPoolInit(g_pool_buffer, sizeof(g_pool_buffer), 2, &state);
+    WorkerPoolInit(g_pool_buffer, sizeof(g_pool_buffer), 3, &reinitState);
+    GeoToNedBatchParallel(g_pool_buffer, originLat, originLon, originAlt, g_parallel_geo, PARALLEL_COUNT, 0, g_parallel_ned, 0, &runState);
+    WorkerPoolShutdown(g_pool_buffer, &shutdownState);
+    WorkerPoolInit(g_pool_buffer, sizeof(g_pool_buffer), 3, &restartState);
+    WorkerPoolShutdown(g_pool_buffer, &state);
+    Check("Live Pool Re-Init Refused", reinitState == EResultState::POOL_ALREADY_STARTED && runState == EResultState::OK &&
+        shutdownState == EResultState::OK && restartState == EResultState::OK && state == EResultState::OK, 0.0, 0.0);
+
+    // Input Validation
+    WorkerPoolInit(g_pool_buffer, sizeof(g_pool_buffer), 0, &state);
+    Check("Zero Threads Check", state == EResultState::THREAD_COUNT_INVALID, 0.0, 0.0);
+    WorkerPoolInit(g_pool_buffer, 16, 2, &state);
+    Check("Small Pool Buffer Check", state == EResultState::BUFFER_TOO_SMALL, 0.0, 0.0);
+    GeoToNedBatchParallel(g_pool_buffer, originLat, originLon, originAlt, g_parallel_geo, PARALLEL_COUNT, 0, g_parallel_ned, 0, &state);
+    Check("Stopped Pool Check", state == EResultState::PREPARED_DATA_INVALID, 0.0, 0.0);
+}
+
+void test_column_conversions() {
+    std::cout << "\n--- Testing GeoToNedColumns / NedToGeoColumns vs batch ---\n";
+
+    // Serial results of test_parallel_batch are the reference
+    const double originLat = 32.1, originLon = 34.8, originAlt = 50.0;
+    const uint32_t count = PARALLEL_COUNT;
+    static double lat[count], lon[count], alt[count], north[count], east[count], down[count];
+    for (uint32_t i = 0; i < count; ++i) {
+        lat[i] = g_parallel_geo[i].latitudeDeg;
+        lon[i] = g_parallel_geo[i].longitudeDeg;
+        alt[i] = g_parallel_geo[i].altitude;
+    }
+
+    // Separate contiguous columns in, fields of a packed record array out
+    uint8_t state;
+    GeoToNedColumns(originLat, originLon, originAlt, lat, lon, alt, count, 0,
+        &g_parallel_ned[0].north, &g_parallel_ned[0].east, &g_parallel_ned[0].down, sizeof(SPointNED), &state);
+    bool identical = state == EResultState::OK && std::memcmp(g_parallel_ned, g_serial_ned, count * sizeof(SPointNED)) == 0;
+
+    // Record array fields in, separate columns out
+    NedToGeoColumns(originLat, originLon, originAlt, &g_serial_ned[0].north, &g_serial_ned[0].east, &g_serial_ned[0].down, count, sizeof(SPointNED),
+        lat, lon, alt, 0, &state);
+    for (uint32_t i = 0; i < count && identical; ++i) {
+        identical = state == EResultState::OK && lat[i] == g_serial_back[i].latitudeDeg && lon[i] == g_serial_back[i].longitudeDeg &&
+            alt[i] == g_serial_back[i].altitude;
+    }
+    Check("Columns Match Batch", identical, 0.0, 0.0);
+
+    GeoToNedColumns(originLat, originLon, originAlt, lat, nullptr, alt, count, 0, north, east, down, 0, &state);
+    Check("Columns Null Check", state == EResultState::POINTS_IS_NULL_PTR, 0.0, 0.0);
+
+    uint8_t outState;
+    GeoToNedColumns(originLat, originLon, originAlt, lat, lon, alt, count, 4, north, east, down, 0, &state);
+    NedToGeoColumns(originLat, originLon, originAlt, north, east, down, count, 0, lat, lon, alt, 4, &outState);
+    Check("Columns Short Stride Rejected", state == EResultState::STRIDE_TOO_SMALL && outState == EResultState::STRIDE_TOO_SMALL, 0.0, 0.0);
+}
+
+void test_ellipsoid_instantiations() {
+    std::cout << "\n--- Testing GRS80 instantiation of the conversion core ---\n";
+
+    // GRS80 and WGS84 share A and differ in 1/f by about 1e-7: the same point lands within
+    // a millimetre, and each ellipsoid round-trips on its own
+    double maxDiff = 0.0;
+    double maxRoundTripAngle = 0.0;
+    double maxRoundTripAlt = 0.0;
+    for (double altitude : GRID_ALTITUDES) {
+        for (int latDeg = -90; latDeg <= 90; latDeg += 3) {
+            for (int k = 0; k < LON_STEPS; k += 7) {
+                const SPointGeo geo = { (double)latDeg, -180.0 + k * LON_STEP_DEG, altitude };
+                const SPointECEF wgs = GeoToEcef<SWgs84Ellipsoid>(geo);
+                const SPointECEF grs = GeoToEcef<SGrs80Ellipsoid>(geo);
+                maxDiff = std::fmax(maxDiff, std::fabs(wgs.x - grs.x) + std::fabs(wgs.y - grs.y) + std::fabs(wgs.z - grs.z));
+
+                const SPointGeo back = EcefToGeoVermeille<SGrs80Ellipsoid>(grs);
+                maxRoundTripAngle = std::fmax(maxRoundTripAngle, std::fabs(back.latitudeDeg - geo.latitudeDeg));
+                if (std::fabs(geo.latitudeDeg) < 90.0) {
+                    maxRoundTripAngle = std::fmax(maxRoundTripAngle, AngleDiffDeg(back.longitudeDeg, geo.longitudeDeg));
+                }
+                maxRoundTripAlt = std::fmax(maxRoundTripAlt, std::fabs(back.altitude - geo.altitude));
+            }
+        }
+    }
+    Check("GRS80 vs WGS84 ECEF", maxDiff > 0.0 && maxDiff < 1e-3, maxDiff, 1e-3);
+    Check("GRS80 Round Trip (angle)", maxRoundTripAngle < ANGLE_BOUND_DEG, maxRoundTripAngle, ANGLE_BOUND_DEG);
+    Check("GRS80 Round Trip (altitude)", maxRoundTripAlt < ALTITUDE_BOUND_M, maxRoundTripAlt, ALTITUDE_BOUND_M);
+
+    // The untemplated overloads are the WGS84 instantiation
+    const SPointGeo probe = { 32.1, 34.8, 50.0 };
+    const SPointECEF a = GeoToEcef(probe);
+    const SPointECEF b = GeoToEcef<SWgs84Ellipsoid>(probe);
+    Check("WGS84 Wrapper Identity", std::memcmp(&a, &b, sizeof(a)) == 0, 0.0, 0.0);
+
+    // Latitude and sin(latitude) forms of the curvature radii agree
+    double maxRadiusDiff = 0.0;
+    for (int latDeg = -90; latDeg <= 90; ++latDeg) {
+        const double lat = latDeg * (PI / 180.0);
+        maxRadiusDiff = std::fmax(maxRadiusDiff, std::fabs(WGS84::RN(lat) - WGS84::RNFromSinLat(std::sin(lat))));
+        maxRadiusDiff = std::fmax(maxRadiusDiff, std::fabs(WGS84::RM(lat) - WGS84::RMFromSinLat(std::sin(lat))));
+    }
+    const bool radiiOk = maxRadiusDiff <= 1e-8 && WGS84::W(0.0) == 1.0 && WGS84::F == SWgs84Ellipsoid::F && EARTH_CONSTS::R0 == WGS84::A;
+    Check("WGS84 Radius Forms Agree [m]", radiiOk, maxRadiusDiff, 1e-8);
+}
+
+int main() {
+    uint8_t activeKernel;
+    GetActiveCoordsKernel(&activeKernel);
+    std::cout << "Active kernel: " << KernelName(activeKernel) << std::endl;
+
+    test_kernel_vs_reference(ECoordsKernel::KERNEL_SCALAR);
+    test_kernel_vs_reference(ECoordsKernel::KERNEL_AVX2);
+    test_kernel_vs_reference(ECoordsKernel::KERNEL_AVX512);
+
+    test_batch_vs_single();
+
+    test_frame_vs_origin();
+
+    test_ecef_to_geo_methods();
+
+    test_parallel_batch();
+
+    test_column_conversions();
+
+    test_series_vs_exact();
+
+    test_ellipsoid_instantiations();
+
+    std::cout << "\n---------------------------------\n";
+    std::cout << "SUMMARY: Passed: " << g_tests_passed << ", Failed: " << g_tests_failed << std::endl;
+
+    return (g_tests_failed == 0) ? 0 : 1;
+}
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <cstring>
 
 // --- Global Log File ---
 std::ofstream g_logFile("test_results_geo.log");
@@ -57,6 +58,19 @@ ApiResult CallIntersect(const SPointNE* poly, uint16_t count, const SPointNE& pt
     return { res, state };
 }
 
+ApiResult CallIsInsidePrepared(const uint8_t* prepared, const SPointNE& pt, float rad) {
+    uint8_t res = false;
+    uint8_t state = EResultState::OK;
+    isInsidePolygonPrepared(prepared, pt, rad, &res, &state);
+    return { res, state };
+}
+
+ApiResult CallPrepare(const SPointNE* poly, uint16_t count, uint8_t* buffer, uint32_t size) {
+    uint8_t state = EResultState::OK;
+    PreparePolygon(poly, count, buffer, size, &state);
+    return { false, state };
+}
+
 // --- Test Runners with Logging ---
 
 // 1. Runner for Circle/Point Tests
@@ -249,15 +263,1195 @@ void test_intersection() {
     RunTest_Line("Grazing Vertex", square_polygon, square_size, { -5.0f, 10.0f }, 90.0f, 10.0f, false);
 }
 
+// Deterministic pseudo random generator (tests must be reproducible)
+uint32_t g_rand_state = 12345u;
+float RandRange(float lo, float hi) {
+    g_rand_state = g_rand_state * 1664525u + 1013904223u;
+    return lo + (hi - lo) * ((g_rand_state >> 8) / 16777216.0f);
+}
+
+// Query point i of the randomized runners: uniform in +-spread, with every 10th one
+// snapped onto a vertex to exercise the boundary cases
+SPointNE RandomQueryPoint(const SPointNE* poly, uint16_t count, float spread, uint32_t i) {
+    return (i % 10 == 0) ? poly[i % count] : SPointNE{ RandRange(-spread, spread), RandRange(-spread, spread) };
+}
+
+// Result line of the randomized runners (a negative count flags a failed setup)
+void ReportMismatches(const std::string& testName, int mismatches) {
+    if (mismatches == 0) {
+        std::cout << "[PASS] " << testName << std::endl;
+        g_tests_passed++;
+    }
+    else {
+        std::cout << "[FAIL] " << testName << " | Mismatches: " << mismatches << std::endl;
+        g_tests_failed++;
+    }
+}
+
+const uint16_t STAR_SIZE = 720;
+SPointNE g_star_pts[STAR_SIZE];
+alignas(8) uint8_t g_prepared_buffer[1 << 20];
+
+// 4. Runner comparing the prepared query with isInsidePolygon on many points and radii
+void RunTest_PreparedMatches(const std::string& testName, const SPointNE* poly, uint16_t count, float spread) {
+    uint32_t size = 0;
+    uint8_t state = EResultState::OK;
+    GetPreparedPolygonSize(poly, count, &size, &state);
+    ApiResult prep = CallPrepare(poly, count, g_prepared_buffer, sizeof(g_prepared_buffer));
+
+    int mismatches = 0;
+    if (state != EResultState::OK || size > sizeof(g_prepared_buffer) || prep.state != EResultState::OK) {
+        mismatches = -1;
+    }
+    else {
+        const float radii[] = { 0.0f, 0.1f, 1.0f, 2.0f, 5.0f };
+        for (uint32_t i = 0; i < 4000; ++i) {
+            const SPointNE pt = RandomQueryPoint(poly, count, spread, i);
+            for (float rad : radii) {
+                ApiResult linear = CallIsInside(poly, count, pt, rad);
+                ApiResult prepared = CallIsInsidePrepared(g_prepared_buffer, pt, rad);
+                if (linear.isCollision != prepared.isCollision || prepared.state != EResultState::OK) {
+                    mismatches++;
+                }
+            }
+        }
+    }
+
+    ReportMismatches(testName, mismatches);
+}
+
+void test_prepared_polygon() {
+    std::cout << "\n--- Testing isInsidePolygonPrepared ---\n";
+
+    // Jagged star: alternating radii make many concave bays
+    for (uint16_t i = 0; i < STAR_SIZE; ++i) {
+        float angle = (float)(2.0 * PI * i / STAR_SIZE);
+        float radius = (i % 2 == 0) ? 100.0f : RandRange(20.0f, 90.0f);
+        g_star_pts[i] = { radius * std::cos(angle), radius * std::sin(angle) };
+    }
+
+    RunTest_PreparedMatches("Prepared Square", square_polygon, square_size, 15.0f);
+    RunTest_PreparedMatches("Prepared U-Shape", u_shape_pts, u_shape_size, 15.0f);
+    RunTest_PreparedMatches("Prepared Triangle", triangle_pts, triangle_size, 15.0f);
+    RunTest_PreparedMatches("Prepared Star", g_star_pts, STAR_SIZE, 120.0f);
+
+    // Input Validation
+    ASSERT_ERROR_STATE(CallPrepare(nullptr, 0, g_prepared_buffer, sizeof(g_prepared_buffer)), EResultState::POLYGON_IS_NULL_PTR, "Prepare Null Poly");
+    ASSERT_ERROR_STATE(CallPrepare(square_polygon, 2, g_prepared_buffer, sizeof(g_prepared_buffer)), EResultState::POLYGON_WITH_LESS_THAN_3_POINTS, "Prepare Small Poly");
+    ASSERT_ERROR_STATE(CallPrepare(square_polygon, square_size, g_prepared_buffer, 16), EResultState::BUFFER_TOO_SMALL, "Prepare Small Buffer");
+    ASSERT_ERROR_STATE(CallPrepare(square_polygon, square_size, g_prepared_buffer + 1, 1024), EResultState::BUFFER_NOT_ALIGNED, "Prepare Misaligned Buffer");
+    ASSERT_ERROR_STATE(CallIsInsidePrepared(nullptr, { 5,5 }, 0), EResultState::BUFFER_IS_NULL_PTR, "Prepared Null Buffer");
+}
+
+const uint32_t BATCH_SIZE = 1000;
+SPointNE g_batch_pts[BATCH_SIZE];
+float g_batch_radii[BATCH_SIZE];
+uint8_t g_batch_results[BATCH_SIZE];
+uint8_t g_batch_bits[(BATCH_SIZE + 7) / 8];
+
+// 5. Runner comparing both batch entry points with isInsidePolygon per point
+void RunTest_BatchMatches(const std::string& testName, const SPointNE* poly, uint16_t count, float spread) {
+    for (uint32_t i = 0; i < BATCH_SIZE; ++i) {
+        g_batch_pts[i] = RandomQueryPoint(poly, count, spread, i);
+        g_batch_radii[i] = (float)(i % 5);
+    }
+
+    int mismatches = 0;
+    const float* radiiModes[] = { nullptr, g_batch_radii };
+    for (const float* radii : radiiModes) {
+        uint8_t s1 = EResultState::OK, s2 = EResultState::OK;
+        isInsidePolygonBatch(poly, count, g_batch_pts, BATCH_SIZE, radii, 1.0f, g_batch_results, &s1);
+        isInsidePolygonBatchBits(poly, count, g_batch_pts, BATCH_SIZE, radii, 1.0f, g_batch_bits, &s2);
+        if (s1 != EResultState::OK || s2 != EResultState::OK) mismatches++;
+
+        for (uint32_t i = 0; i < BATCH_SIZE; ++i) {
+            ApiResult single = CallIsInside(poly, count, g_batch_pts[i], radii ? radii[i] : 1.0f);
+            uint8_t bit = (g_batch_bits[i / 8] >> (i % 8)) & 1;
+            if (single.isCollision != g_batch_results[i] || single.isCollision != bit) mismatches++;
+        }
+    }
+
+    ReportMismatches(testName, mismatches);
+}
+
+ApiResult CallIsInsideBatch(const SPointNE* poly, uint16_t count, const SPointNE* pts, uint32_t n) {
+    uint8_t state = EResultState::OK;
+    isInsidePolygonBatch(poly, count, pts, n, nullptr, 0.0f, g_batch_results, &state);
+    return { false, state };
+}
+
+void RunTest_ColumnsMatch(const std::string& name, const SPointNE* poly, uint16_t count, float range) {
+    // North / east / azimuth / length as fields of one double record array (stride 32)
+    const uint32_t lineCount = 500;
+    static double records[lineCount][4];
+    static uint8_t insideResults[lineCount], lineResults[lineCount];
+    for (uint32_t i = 0; i < lineCount; ++i) {
+        records[i][0] = RandRange(-range, range);
+        records[i][1] = RandRange(-range, range);
+        records[i][2] = RandRange(0.0f, 360.0f);
+        records[i][3] = (i % 50 == 7) ? 0.0 : RandRange(1.0f, range);
+    }
+
+    uint8_t insideState = EResultState::OK, lineState = EResultState::OK;
+    isInsidePolygonColumns(poly, count, &records[0][0], &records[0][1], lineCount, sizeof(records[0]), 2.0f, insideResults, &insideState);
+    doesLineIntersectPolygonColumns(poly, count, &records[0][0], &records[0][1], &records[0][2], &records[0][3], lineCount, sizeof(records[0]),
+        lineResults, &lineState);
+
+    int mismatches = 0;
+    for (uint32_t i = 0; i < lineCount; ++i) {
+        const SPointNE pt = { (float)records[i][0], (float)records[i][1] };
+        mismatches += insideResults[i] != CallIsInside(poly, count, pt, 2.0f).isCollision;
+        mismatches += lineResults[i] != CallIntersect(poly, count, pt, (float)records[i][2], (float)records[i][3]).isCollision;
+    }
+    bool passed = mismatches == 0 && insideState == EResultState::OK && lineState == EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO;
+    std::cout << (passed ? "[PASS] " : "[FAIL] ") << name << " | Mismatches: " << mismatches << ", States: " << (int)insideState << "/" << (int)lineState << std::endl;
+    passed ? g_tests_passed++ : g_tests_failed++;
+}
+
+void test_batch_polygon() {
+    std::cout << "\n--- Testing isInsidePolygonBatch ---\n";
+
+    RunTest_BatchMatches("Batch Square", square_polygon, square_size, 15.0f);
+    RunTest_BatchMatches("Batch U-Shape", u_shape_pts, u_shape_size, 15.0f);
+    RunTest_BatchMatches("Batch Star", g_star_pts, STAR_SIZE, 120.0f);
+
+    // Strided double columns (isInsidePolygonColumns / doesLineIntersectPolygonColumns)
+    RunTest_ColumnsMatch("Columns U-Shape", u_shape_pts, u_shape_size, 15.0f);
+    RunTest_ColumnsMatch("Columns Star", g_star_pts, STAR_SIZE, 120.0f);
+
+    // Input Validation
+    ASSERT_ERROR_STATE(CallIsInsideBatch(nullptr, 0, g_batch_pts, BATCH_SIZE), EResultState::POLYGON_IS_NULL_PTR, "Batch Null Poly");
+    ASSERT_ERROR_STATE(CallIsInsideBatch(square_polygon, 2, g_batch_pts, BATCH_SIZE), EResultState::POLYGON_WITH_LESS_THAN_3_POINTS, "Batch Small Poly");
+    ASSERT_ERROR_STATE(CallIsInsideBatch(square_polygon, square_size, nullptr, BATCH_SIZE), EResultState::POINTS_IS_NULL_PTR, "Batch Null Points");
+}
+
+const uint32_t ZONE_COUNT = 500;
+const uint16_t ZONE_MAX_POINTS = 8;
+SPointNE g_zone_pts[ZONE_COUNT * ZONE_MAX_POINTS];
+uint16_t g_zone_counts[ZONE_COUNT];
+uint32_t g_zone_ids[ZONE_COUNT];
+uint32_t g_zone_hits[ZONE_COUNT];
+uint8_t g_zone_expected[ZONE_COUNT];
+alignas(8) uint8_t g_zone_buffer[1 << 18];
+
+// Zone z is a random convex-ish ring around a random center; reported ID is 1000 + 3z
+void BuildTestZones() {
+    uint32_t first = 0;
+    for (uint32_t z = 0; z < ZONE_COUNT; ++z) {
+        SPointNE center = { RandRange(-2000.0f, 2000.0f), RandRange(-2000.0f, 2000.0f) };
+        float size = RandRange(5.0f, 80.0f);
+        g_zone_counts[z] = (uint16_t)(3 + z % (ZONE_MAX_POINTS - 2));
+        g_zone_ids[z] = 1000 + 3 * z;
+        for (uint16_t i = 0; i < g_zone_counts[z]; ++i) {
+            float angle = (float)(2.0 * PI * i / g_zone_counts[z]);
+            float radius = size * RandRange(0.5f, 1.0f);
+            g_zone_pts[first + i] = { center.north + radius * std::cos(angle), center.east + radius * std::sin(angle) };
+        }
+        first += g_zone_counts[z];
+    }
+}
+
+// Compares a zone query result with the per-zone API over every zone
+bool ZoneHitsMatch(uint32_t hitCount, bool isSegment, SPointNE pt, float radOrAz, float len) {
+    uint32_t first = 0;
+    uint32_t expectedCount = 0;
+    for (uint32_t z = 0; z < ZONE_COUNT; ++z) {
+        ApiResult r = isSegment ? CallIntersect(&g_zone_pts[first], g_zone_counts[z], pt, radOrAz, len)
+            : CallIsInside(&g_zone_pts[first], g_zone_counts[z], pt, radOrAz);
+        g_zone_expected[z] = r.isCollision;
+        expectedCount += r.isCollision;
+        first += g_zone_counts[z];
+    }
+    if (hitCount != expectedCount) return false;
+    for (uint32_t h = 0; h < hitCount; ++h) {
+        uint32_t z = (g_zone_hits[h] - 1000) / 3;
+        if (z >= ZONE_COUNT || !g_zone_expected[z]) return false;
+        g_zone_expected[z] = false; // reported once
+    }
+    return true;
+}
+
+void test_zone_index() {
+    std::cout << "\n--- Testing QueryZonesCircle / QueryZonesSegment ---\n";
+
+    BuildTestZones();
+    uint32_t size = 0;
+    uint8_t state = EResultState::OK;
+    GetPreparedZonesSize(g_zone_counts, ZONE_COUNT, &size, &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::OK, "Zones Size");
+    PrepareZones(g_zone_pts, g_zone_counts, g_zone_ids, ZONE_COUNT, g_zone_buffer, sizeof(g_zone_buffer), &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::OK, "Zones Prepare");
+
+    int circleMismatches = 0;
+    int segmentMismatches = 0;
+    for (int i = 0; i < 2000; ++i) {
+        SPointNE pt = { RandRange(-2100.0f, 2100.0f), RandRange(-2100.0f, 2100.0f) };
+        if (i % 10 == 0) pt = g_zone_pts[i % ZONE_COUNT];
+        float rad = (float)(i % 4) * 25.0f;
+        uint32_t count = 0;
+        QueryZonesCircle(g_zone_buffer, pt, rad, g_zone_hits, ZONE_COUNT, &count, &state);
+        if (state != EResultState::OK || !ZoneHitsMatch(count, false, pt, rad, 0.0f)) circleMismatches++;
+
+        float az = RandRange(0.0f, 360.0f);
+        float len = RandRange(1.0f, 600.0f);
+        QueryZonesSegment(g_zone_buffer, pt, az, len, g_zone_hits, ZONE_COUNT, &count, &state);
+        if (state != EResultState::OK || !ZoneHitsMatch(count, true, pt, az, len)) segmentMismatches++;
+    }
+
+    std::cout << (circleMismatches == 0 ? "[PASS] " : "[FAIL] ") << "Zones Circle Matches Linear | Mismatches: " << circleMismatches << std::endl;
+    (circleMismatches == 0) ? g_tests_passed++ : g_tests_failed++;
+    std::cout << (segmentMismatches == 0 ? "[PASS] " : "[FAIL] ") << "Zones Segment Matches Linear | Mismatches: " << segmentMismatches << std::endl;
+    (segmentMismatches == 0) ? g_tests_passed++ : g_tests_failed++;
+
+    // Output capacity: IDs are truncated, the count is still the total
+    uint32_t count = 0;
+    QueryZonesCircle(g_zone_buffer, { 0.0f, 0.0f }, 3000.0f, g_zone_hits, 10, &count, &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::OUTPUT_TOO_SMALL, "Zones Output Too Small");
+    std::cout << (count == ZONE_COUNT ? "[PASS] " : "[FAIL] ") << "Zones Total Count Reported | Count: " << count << std::endl;
+    (count == ZONE_COUNT) ? g_tests_passed++ : g_tests_failed++;
+
+    // Input Validation
+    QueryZonesCircle(nullptr, { 0.0f, 0.0f }, 0.0f, g_zone_hits, ZONE_COUNT, &count, &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::BUFFER_IS_NULL_PTR, "Zones Null Buffer");
+    PrepareZones(g_zone_pts, g_zone_counts, nullptr, ZONE_COUNT, g_zone_buffer, 64, &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::BUFFER_TOO_SMALL, "Zones Small Buffer");
+    QueryZonesSegment(g_zone_buffer, { 0.0f, 0.0f }, 0.0f, 0.0f, g_zone_hits, ZONE_COUNT, &count, &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO, "Zones Zero Length");
+}
+
+const uint32_t RAY_COUNT = 2000;
+SRayNE g_rays[RAY_COUNT];
+SRayHit g_ray_hits[RAY_COUNT];
+
+// 6. Runner checking getFirstRayHit against doesLineIntersectPolygon, the batch and the prepared variant
+void RunTest_RayHits(const std::string& testName, const SPointNE* poly, uint16_t count, float spread) {
+    for (uint32_t i = 0; i < RAY_COUNT; ++i) {
+        const SPointNE start = RandomQueryPoint(poly, count, spread, i);
+        g_rays[i] = { start, RandRange(0.0f, 360.0f), RandRange(0.5f, 2.0f * spread) };
+    }
+
+    uint8_t state = EResultState::OK;
+    getFirstRayHitBatch(poly, count, g_rays, RAY_COUNT, g_ray_hits, &state);
+    CallPrepare(poly, count, g_prepared_buffer, sizeof(g_prepared_buffer));
+
+    int mismatches = (state == EResultState::OK) ? 0 : 1;
+    for (uint32_t i = 0; i < RAY_COUNT; ++i) {
+        const SRayNE& ray = g_rays[i];
+        SRayHit hit, prepared;
+        uint8_t s1 = EResultState::OK, s2 = EResultState::OK;
+        getFirstRayHit(poly, count, ray, &hit, &s1);
+        getFirstRayHitPrepared(g_prepared_buffer, ray, &prepared, &s2);
+        ApiResult linear = CallIntersect(poly, count, ray.startPoint, ray.azimuthDegrees, ray.maxLength);
+
+        bool ok = s1 == EResultState::OK && s2 == EResultState::OK && hit.isHit == linear.isCollision;
+        ok = ok && std::memcmp(&hit, &g_ray_hits[i], sizeof(SRayHit)) == 0 && std::memcmp(&hit, &prepared, sizeof(SRayHit)) == 0;
+
+        if (ok && hit.isHit && hit.edgeIndex != 0xFFFF) {
+            // The contact lies on the reported edge, and nothing is hit before it
+            double dSq = getDistToSegmentSquared(hit.hitPoint, poly[hit.edgeIndex], poly[(hit.edgeIndex + 1) % count]);
+            ok = dSq < 1e-6;
+            if (hit.distance > 0.1f) {
+                ok = ok && !CallIntersect(poly, count, ray.startPoint, ray.azimuthDegrees, hit.distance - 0.05f).isCollision;
+            }
+        }
+        if (!ok) mismatches++;
+    }
+
+    ReportMismatches(testName, mismatches);
+}
+
+ApiResult CallFirstRayHit(const SPointNE* poly, uint16_t count, SRayNE ray) {
+    SRayHit hit;
+    uint8_t state = EResultState::OK;
+    getFirstRayHit(poly, count, ray, &hit, &state);
+    return { hit.isHit, state };
+}
+
+void test_first_ray_hit() {
+    std::cout << "\n--- Testing getFirstRayHit ---\n";
+
+    RunTest_RayHits("Ray Hits Square", square_polygon, square_size, 15.0f);
+    RunTest_RayHits("Ray Hits U-Shape", u_shape_pts, u_shape_size, 15.0f);
+    RunTest_RayHits("Ray Hits Star", g_star_pts, STAR_SIZE, 120.0f);
+
+    // Square (0,0)-(10,10): a ray from the South along the North axis touches edge 0 after 5 m
+    SRayHit hit;
+    uint8_t state = EResultState::OK;
+    getFirstRayHit(square_polygon, square_size, { { -5.0f, 5.0f }, 0.0f, 20.0f }, &hit, &state);
+    bool ok = hit.isHit && std::fabs(hit.distance - 5.0f) < 1e-4f && std::fabs(hit.hitPoint.north) < 1e-4f && std::fabs(hit.hitPoint.east - 5.0f) < 1e-4f;
+    std::cout << (ok ? "[PASS] " : "[FAIL] ") << "Ray Hit Distance | Distance: " << hit.distance << ", Edge: " << hit.edgeIndex << std::endl;
+    ok ? g_tests_passed++ : g_tests_failed++;
+
+    // Input Validation
+    ASSERT_ERROR_STATE(CallFirstRayHit(nullptr, 0, { { 0, 0 }, 0, 1 }), EResultState::POLYGON_IS_NULL_PTR, "Ray Null Poly");
+    ASSERT_ERROR_STATE(CallFirstRayHit(square_polygon, 2, { { 0, 0 }, 0, 1 }), EResultState::POLYGON_WITH_LESS_THAN_3_POINTS, "Ray Small Poly");
+    ASSERT_ERROR_STATE(CallFirstRayHit(square_polygon, square_size, { { 0, 0 }, 0, 0 }), EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO, "Ray Zero Length");
+}
+
+// 7. Float fast path vs double accurate path on well-conditioned random segments
+void test_precision_paths() {
+    std::cout << "\n--- Testing Float vs Double Precision Paths ---\n";
+
+    int intersectMismatches = 0;
+    double maxRelDistErr = 0.0;
+    for (int i = 0; i < 5000; ++i) {
+        SPointNE p1 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+        SPointNE q1 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+        SPointNE p2 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+        SPointNE q2 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+
+        if (doSegmentsIntersect<SFloatPrecision>(p1, q1, p2, q2) != doSegmentsIntersect<SDoublePrecision>(p1, q1, p2, q2)) {
+            intersectMismatches++;
+        }
+
+        double dDouble = getDistToSegmentSquared<SDoublePrecision>(p1, p2, q2);
+        double dFloat = getDistToSegmentSquared<SFloatPrecision>(p1, p2, q2);
+        if (dDouble > 1.0) maxRelDistErr = std::fmax(maxRelDistErr, std::fabs(dFloat - dDouble) / dDouble);
+    }
+
+    std::cout << (intersectMismatches == 0 ? "[PASS] " : "[FAIL] ") << "doSegmentsIntersect Float == Double | Mismatches: " << intersectMismatches << std::endl;
+    (intersectMismatches == 0) ? g_tests_passed++ : g_tests_failed++;
+    std::cout << (maxRelDistErr < 1e-4 ? "[PASS] " : "[FAIL] ") << "getDistToSegmentSquared Float ~ Double | Max Rel Error: " << maxRelDistErr << std::endl;
+    (maxRelDistErr < 1e-4) ? g_tests_passed++ : g_tests_failed++;
+
+    // Near-collinear triplets at 10 km: the plain float sign is rounding noise, the float policy
+    // reports collinear instead of a sign the exact predicate contradicts
+    int wrongSigns = 0;
+    int rawWrongSigns = 0;
+    for (int i = 0; i < 5000; ++i) {
+        const SPointNE p = { RandRange(-1e4f, 1e4f), RandRange(-1e4f, 1e4f) };
+        const SPointNE q = { p.north + RandRange(-1e3f, 1e3f), p.east + RandRange(-1e3f, 1e3f) };
+        const float t = RandRange(-1.0f, 2.0f);
+        const SPointNE r = { p.north + t * (q.north - p.north), p.east + t * (q.east - p.east) };
+
+        const int exact = orientation<SRobustPrecision>(p, q, r);
+        const int banded = orientation<SFloatPrecision>(p, q, r);
+        if (banded != 0 && banded != exact) wrongSigns++;
+
+        const float raw = (q.east - p.east) * (r.north - q.north) - (q.north - p.north) * (r.east - q.east);
+        if (raw != 0.0f && (raw > 0.0f ? 1 : 2) != exact) rawWrongSigns++;
+    }
+    std::cout << (wrongSigns == 0 ? "[PASS] " : "[FAIL] ") << "Float Orientation Never Contradicts Exact | Wrong Signs: " << wrongSigns << std::endl;
+    (wrongSigns == 0) ? g_tests_passed++ : g_tests_failed++;
+    // Guards the test itself: without the band the float sign is wrong on some of these triplets
+    std::cout << (rawWrongSigns > 0 ? "[PASS] " : "[FAIL] ") << "Unbanded Float Sign Misses Near-Collinear | Wrong Signs: " << rawWrongSigns << std::endl;
+    (rawWrongSigns > 0) ? g_tests_passed++ : g_tests_failed++;
+}
+
+// 8. Runner checking getPolygonClearance against isInsidePolygon and a brute-force nearest edge
+void RunTest_Clearance(const std::string& testName, const SPointNE* poly, uint16_t count, float spread) {
+    const float radii[] = { 0.0f, 0.5f, 2.0f, 10.0f };
+    int mismatches = 0;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        const SPointNE pt = RandomQueryPoint(poly, count, spread, i);
+        for (float rad : radii) {
+            SPolygonClearance clearance;
+            uint8_t state = EResultState::OK;
+            getPolygonClearance(poly, count, pt, rad, &clearance, &state);
+            ApiResult linear = CallIsInside(poly, count, pt, rad);
+            ApiResult center = CallIsInside(poly, count, pt, 0.0f);
+
+            double minDist = INFINITY;
+            for (uint16_t k = 0; k < count; ++k) {
+                minDist = std::fmin(minDist, std::sqrt(getDistToSegmentSquared(pt, poly[k], poly[(k + 1) % count])));
+            }
+            double nearestDist = std::sqrt(getDistToSegmentSquared(pt, poly[clearance.nearestEdge], poly[(clearance.nearestEdge + 1) % count]));
+
+            bool ok = state == EResultState::OK && clearance.isCollision == linear.isCollision;
+            ok = ok && nearestDist == minDist && std::fabs(std::fabs(clearance.signedDistance) - minDist) < 1e-4;
+            // Away from the boundary the sign follows the center's containment
+            ok = ok && (minDist < 1e-3 || (clearance.signedDistance < 0.0f) == (center.isCollision != 0));
+            ok = ok && std::fabs(clearance.clearance - (clearance.signedDistance - rad)) < 1e-4;
+            if (!ok) mismatches++;
+        }
+    }
+
+    ReportMismatches(testName, mismatches);
+}
+
+ApiResult CallClearance(const SPointNE* poly, uint16_t count, SPointNE pt, float rad) {
+    SPolygonClearance clearance;
+    uint8_t state = EResultState::OK;
+    getPolygonClearance(poly, count, pt, rad, &clearance, &state);
+    return { clearance.isCollision, state };
+}
+
+void test_polygon_clearance() {
+    std::cout << "\n--- Testing getPolygonClearance ---\n";
+
+    RunTest_Clearance("Clearance Square", square_polygon, square_size, 15.0f);
+    RunTest_Clearance("Clearance U-Shape", u_shape_pts, u_shape_size, 15.0f);
+    RunTest_Clearance("Clearance Star", g_star_pts, STAR_SIZE, 120.0f);
+
+    // Square (0,0)-(10,10): center 3 m East of edge 1, a 1 m radius leaves a 2 m margin
+    SPolygonClearance clearance;
+    uint8_t state = EResultState::OK;
+    getPolygonClearance(square_polygon, square_size, { 5.0f, 13.0f }, 1.0f, &clearance, &state);
+    bool ok = !clearance.isCollision && clearance.nearestEdge == 1 && std::fabs(clearance.signedDistance - 3.0f) < 1e-5f && std::fabs(clearance.clearance - 2.0f) < 1e-5f;
+    std::cout << (ok ? "[PASS] " : "[FAIL] ") << "Clearance Margin | Signed Distance: " << clearance.signedDistance << ", Clearance: " << clearance.clearance << std::endl;
+    ok ? g_tests_passed++ : g_tests_failed++;
+
+    // Input Validation
+    ASSERT_ERROR_STATE(CallClearance(nullptr, 0, { 5, 5 }, 1.0f), EResultState::POLYGON_IS_NULL_PTR, "Clearance Null Poly");
+    ASSERT_ERROR_STATE(CallClearance(square_polygon, 2, { 5, 5 }, 1.0f), EResultState::POLYGON_WITH_LESS_THAN_3_POINTS, "Clearance Small Poly");
+}
+
+// 9. Runner comparing the bounds-aware queries with the plain ones, near and far from the polygon
+void RunTest_BoundedMatches(const std::string& testName, const SPointNE* poly, uint16_t count, float spread) {
+    SPolygonBounds bounds;
+    uint8_t state = EResultState::OK;
+    InitPolygonBounds(poly, count, &bounds, &state);
+
+    int mismatches = (state == EResultState::OK) ? 0 : 1;
+    for (uint32_t i = 0; i < 4000; ++i) {
+        const SPointNE pt = RandomQueryPoint(poly, count, (i % 2 == 0) ? spread : 5.0f * spread, i);
+        float rad = RandRange(0.0f, 0.2f * spread);
+        float az = RandRange(0.0f, 360.0f);
+        float len = RandRange(0.1f, 2.0f * spread);
+
+        uint8_t res, st;
+        isInsidePolygonBounded(poly, count, &bounds, pt, rad, &res, &st);
+        if (st != EResultState::OK || res != CallIsInside(poly, count, pt, rad).isCollision) mismatches++;
+        doesLineIntersectPolygonBounded(poly, count, &bounds, pt, az, len, &res, &st);
+        if (st != EResultState::OK || res != CallIntersect(poly, count, pt, az, len).isCollision) mismatches++;
+    }
+
+    ReportMismatches(testName, mismatches);
+}
+
+ApiResult CallIsInsideBounded(const SPointNE* poly, uint16_t count, const SPolygonBounds* bounds, SPointNE pt, float rad) {
+    uint8_t res = false;
+    uint8_t state = EResultState::OK;
+    isInsidePolygonBounded(poly, count, bounds, pt, rad, &res, &state);
+    return { res, state };
+}
+
+void test_polygon_bounds() {
+    std::cout << "\n--- Testing isInsidePolygonBounded / doesLineIntersectPolygonBounded ---\n";
+
+#if defined(API_FUNCTIONS_INSTRUMENTED)
+    ResetInstrumentation();
+#endif
+
+    RunTest_BoundedMatches("Bounded Square", square_polygon, square_size, 15.0f);
+    RunTest_BoundedMatches("Bounded U-Shape", u_shape_pts, u_shape_size, 15.0f);
+    RunTest_BoundedMatches("Bounded Star", g_star_pts, STAR_SIZE, 120.0f);
+
+#if defined(API_FUNCTIONS_INSTRUMENTED)
+    // Half of the queries are drawn far away, so every reject path must have fired
+    SInstrumentationSnapshot snapshot;
+    SnapshotInstrumentation(&snapshot);
+    const uint64_t* counters = snapshot.rejectCounters;
+    bool fired = counters[ERejectCounterID::InsideBoxRejects] > 0 && counters[ERejectCounterID::InsideCircleRejects] > 0 &&
+        counters[ERejectCounterID::IntersectBoxRejects] > 0 && counters[ERejectCounterID::IntersectCircleRejects] > 0;
+    std::cout << (fired ? "[PASS] " : "[FAIL] ") << "Early Reject Counters | Inside: " << counters[ERejectCounterID::InsideBoxRejects] << "+"
+        << counters[ERejectCounterID::InsideCircleRejects] << "/" << counters[ERejectCounterID::InsideQueries] << ", Intersect: "
+        << counters[ERejectCounterID::IntersectBoxRejects] << "+" << counters[ERejectCounterID::IntersectCircleRejects] << "/"
+        << counters[ERejectCounterID::IntersectQueries] << std::endl;
+    fired ? g_tests_passed++ : g_tests_failed++;
+#endif
+
+    // Input Validation
+    SPolygonBounds bounds;
+    uint8_t state = EResultState::OK;
+    InitPolygonBounds(square_polygon, square_size, &bounds, &state);
+    ASSERT_ERROR_STATE(CallIsInsideBounded(square_polygon, square_size, nullptr, { 5, 5 }, 1.0f), EResultState::BUFFER_IS_NULL_PTR, "Bounded Null Bounds");
+    ASSERT_ERROR_STATE(CallIsInsideBounded(u_shape_pts, u_shape_size, &bounds, { 5, 5 }, 1.0f), EResultState::PREPARED_DATA_INVALID, "Bounded Mismatched Bounds");
+    ASSERT_ERROR_STATE(CallIsInsideBounded(nullptr, 0, &bounds, { 5, 5 }, 1.0f), EResultState::POLYGON_IS_NULL_PTR, "Bounded Null Poly");
+}
+
+// 10. Scratch arena over a static buffer
+alignas(64) uint8_t g_arena_buffer[1024];
+
+void ExpectArena(bool condition, const std::string& testName) {
+    if (condition) {
+        std::cout << "[PASS] " << testName << std::endl;
+        g_tests_passed++;
+    }
+    else {
+        std::cout << "[FAIL] " << testName << std::endl;
+        g_tests_failed++;
+    }
+}
+
+ApiResult CallArenaAlloc(SArena* arena, uint32_t size, uint32_t alignment, uint8_t** outPtr) {
+    uint8_t state = EResultState::OK;
+    ArenaAlloc(arena, size, alignment, outPtr, &state);
+    return { false, state };
+}
+
+void test_scratch_arena() {
+    std::cout << "\n--- Testing ArenaInit / ArenaAlloc / ArenaMark / ArenaRewind ---\n";
+
+    SArena arena;
+    uint8_t state = EResultState::OK;
+    uint8_t* a = nullptr;
+    uint8_t* b = nullptr;
+    uint32_t mark = 0;
+    uint32_t highWater = 0;
+
+    // Start one byte into the buffer so alignment has to be applied to the address
+    ArenaInit(&arena, g_arena_buffer + 1, sizeof(g_arena_buffer) - 1, &state);
+    ExpectArena(state == EResultState::OK, "Arena Init");
+
+    ArenaAlloc(&arena, 10, 1, &a, &state);
+    ArenaAlloc(&arena, 100, 64, &b, &state);
+    ExpectArena(state == EResultState::OK && a == g_arena_buffer + 1 && b == g_arena_buffer + 64, "Arena Aligned Alloc");
+
+    ArenaMark(&arena, &mark, &state);
+    ArenaAlloc(&arena, 500, 8, &a, &state);
+    ExpectArena(state == EResultState::OK && a == g_arena_buffer + 168, "Arena Alloc After Mark");
+
+    // Out of space: reported, nothing consumed
+    uint32_t before = arena.used;
+    ASSERT_ERROR_STATE(CallArenaAlloc(&arena, 1000, 8, &a), EResultState::BUFFER_TOO_SMALL, "Arena Out Of Space");
+    ExpectArena(a == nullptr && arena.used == before, "Arena Unchanged After Failure");
+
+    ArenaRewind(&arena, mark, &state);
+    ArenaAlloc(&arena, 500, 8, &a, &state);
+    ArenaHighWater(&arena, &highWater, &state);
+    ExpectArena(state == EResultState::OK && a == g_arena_buffer + 168 && highWater == 667, "Arena Rewind Reuses Memory");
+
+    ArenaRewind(&arena, 0, &state);
+    ArenaHighWater(&arena, &highWater, &state);
+    ExpectArena(arena.used == 0 && highWater == 667, "Arena High Water Survives Rewind");
+
+    // Input Validation
+    ASSERT_ERROR_STATE(CallArenaAlloc(&arena, 8, 3, &a), EResultState::BUFFER_NOT_ALIGNED, "Arena Bad Alignment");
+    ASSERT_ERROR_STATE(CallArenaAlloc(nullptr, 8, 8, &a), EResultState::BUFFER_IS_NULL_PTR, "Arena Null Arena");
+    ArenaRewind(&arena, 1, &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::ARENA_MARK_INVALID, "Arena Mark Past Position");
+    ArenaInit(&arena, nullptr, 64, &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::BUFFER_IS_NULL_PTR, "Arena Null Buffer");
+}
+
+// 11. Parallel containment batch against the serial batch
+alignas(64) uint8_t g_pool_buffer[1 << 14];
+uint8_t g_parallel_results[BATCH_SIZE];
+
+void test_parallel_batch_polygon() {
+    std::cout << "\n--- Testing isInsidePolygonBatchParallel ---\n";
+
+    for (uint32_t i = 0; i < BATCH_SIZE; ++i) {
+        g_batch_pts[i] = { RandRange(-120.0f, 120.0f), RandRange(-120.0f, 120.0f) };
+        g_batch_radii[i] = (float)(i % 5);
+    }
+    uint8_t state = EResultState::OK;
+    isInsidePolygonBatch(g_star_pts, STAR_SIZE, g_batch_pts, BATCH_SIZE, g_batch_radii, 0.0f, g_batch_results, &state);
+
+    const uint32_t threadCounts[] = { 1, 2, 5 };
+    for (uint32_t threads : threadCounts) {
+        WorkerPoolInit(g_pool_buffer, sizeof(g_pool_buffer), threads, &state);
+        bool identical = (state == EResultState::OK);
+
+        isInsidePolygonBatchParallel(g_pool_buffer, g_star_pts, STAR_SIZE, g_batch_pts, BATCH_SIZE, g_batch_radii, 0.0f, g_parallel_results, &state);
+        identical = identical && state == EResultState::OK && std::memcmp(g_parallel_results, g_batch_results, BATCH_SIZE) == 0;
+
+        isInsidePolygonBatchParallel(g_pool_buffer, g_star_pts, 2, g_batch_pts, BATCH_SIZE, nullptr, 0.0f, g_parallel_results, &state);
+        identical = identical && state == EResultState::POLYGON_WITH_LESS_THAN_3_POINTS;
+
+        WorkerPoolShutdown(g_pool_buffer, &state);
+        identical = identical && state == EResultState::OK;
+
+        if (identical) {
+            std::cout << "[PASS] Parallel Containment x" << threads << " threads" << std::endl;
+            g_tests_passed++;
+        }
+        else {
+            std::cout << "[FAIL] Parallel Containment x" << threads << " threads" << std::endl;
+            g_tests_failed++;
+        }
+    }
+
+    // Input Validation
+    isInsidePolygonBatchParallel(nullptr, g_star_pts, STAR_SIZE, g_batch_pts, BATCH_SIZE, nullptr, 0.0f, g_parallel_results, &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::BUFFER_IS_NULL_PTR, "Parallel Null Pool");
+    isInsidePolygonBatchParallel(g_pool_buffer, g_star_pts, STAR_SIZE, g_batch_pts, BATCH_SIZE, nullptr, 0.0f, g_parallel_results, &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::PREPARED_DATA_INVALID, "Parallel Stopped Pool");
+    WorkerPoolInit(g_pool_buffer, sizeof(g_pool_buffer), 65, &state);
+    ASSERT_ERROR_STATE((ApiResult{ false, state }), EResultState::THREAD_COUNT_INVALID, "Parallel Too Many Threads");
+}
+
+// 12. Route checks against a per-leg reference (containment of every leg start + every edge)
+const uint32_t ROUTE_SIZE = 200;
+SPointNE g_route_pts[ROUTE_SIZE];
+
+uint32_t ReferenceFirstViolatingLeg(const SPointNE* poly, uint16_t count, const SPointNE* route, uint32_t routeSize) {
+    for (uint32_t leg = 0; leg + 1 < routeSize; ++leg) {
+        if (CallIsInside(poly, count, route[leg], 0.0f).isCollision) return leg;
+        for (uint16_t k = 0; k < count; ++k) {
+            if (doSegmentsIntersect(route[leg], route[leg + 1], poly[k], poly[(k + 1) % count])) return leg;
+        }
+    }
+    return 0xFFFFFFFF;
+}
+
+ApiResult CallRoute(const SPointNE* poly, uint16_t count, const SPointNE* route, uint32_t routeSize, SRouteViolation* outViolation) {
+    uint8_t state = EResultState::OK;
+    doesRouteIntersectPolygon(poly, count, route, routeSize, outViolation, &state);
+    return { outViolation->isViolation, state };
+}
+
+void test_route_polygon() {
+    std::cout << "\n--- Testing doesRouteIntersectPolygon ---\n";
+
+    // 1. Known crossing: leg 1 enters the square through edge 0 (North = 0) at 20% of the leg
+    SPointNE route[] = { { -5.0f, 5.0f }, { -2.0f, 5.0f }, { 8.0f, 5.0f }, { 8.0f, 20.0f } };
+    SRouteViolation violation;
+    ApiResult res = CallRoute(square_polygon, square_size, route, 4, &violation);
+    bool known = res.state == EResultState::OK && violation.isViolation && violation.legIndex == 1 && violation.edgeIndex == 0 &&
+        std::fabs(violation.legParam - 0.2f) < 1e-6f && std::fabs(violation.hitPoint.north) < 1e-5f && std::fabs(violation.hitPoint.east - 5.0f) < 1e-5f;
+    std::cout << (known ? "[PASS] " : "[FAIL] ") << "Route Known Crossing" << std::endl;
+    known ? g_tests_passed++ : g_tests_failed++;
+
+    // 2. Clear route around the square, and a route starting inside it
+    SPointNE clear[] = { { -5.0f, -5.0f }, { -5.0f, 15.0f }, { 15.0f, 15.0f }, { 15.0f, -5.0f } };
+    res = CallRoute(square_polygon, square_size, clear, 4, &violation);
+    bool isClear = res.state == EResultState::OK && !violation.isViolation && violation.legIndex == 0xFFFFFFFF;
+    std::cout << (isClear ? "[PASS] " : "[FAIL] ") << "Route Clear" << std::endl;
+    isClear ? g_tests_passed++ : g_tests_failed++;
+
+    SPointNE inside[] = { { 5.0f, 5.0f }, { 50.0f, 50.0f } };
+    res = CallRoute(square_polygon, square_size, inside, 2, &violation);
+    bool startsInside = violation.isViolation && violation.legIndex == 0 && violation.edgeIndex == 0xFFFF && violation.legParam == 0.0f;
+    std::cout << (startsInside ? "[PASS] " : "[FAIL] ") << "Route Starts Inside" << std::endl;
+    startsInside ? g_tests_passed++ : g_tests_failed++;
+
+    // 3. Random walks around the star agree with the per-leg reference
+    int mismatches = 0;
+    for (int trial = 0; trial < 300; ++trial) {
+        g_route_pts[0] = { RandRange(-400.0f, 400.0f), RandRange(-400.0f, 400.0f) };
+        for (uint32_t i = 1; i < ROUTE_SIZE; ++i) {
+            g_route_pts[i] = { g_route_pts[i - 1].north + RandRange(-30.0f, 30.0f), g_route_pts[i - 1].east + RandRange(-30.0f, 30.0f) };
+        }
+        CallRoute(g_star_pts, STAR_SIZE, g_route_pts, ROUTE_SIZE, &violation);
+        if (violation.legIndex != ReferenceFirstViolatingLeg(g_star_pts, STAR_SIZE, g_route_pts, ROUTE_SIZE)) mismatches++;
+    }
+    std::cout << (mismatches == 0 ? "[PASS] " : "[FAIL] ") << "Route Random Walks | Mismatches: " << mismatches << std::endl;
+    (mismatches == 0) ? g_tests_passed++ : g_tests_failed++;
+
+    // Input Validation
+    ASSERT_ERROR_STATE(CallRoute(nullptr, 0, route, 4, &violation), EResultState::POLYGON_IS_NULL_PTR, "Route Null Poly");
+    ASSERT_ERROR_STATE(CallRoute(square_polygon, square_size, nullptr, 4, &violation), EResultState::POINTS_IS_NULL_PTR, "Route Null Waypoints");
+    ASSERT_ERROR_STATE(CallRoute(square_polygon, square_size, route, 1, &violation), EResultState::ROUTE_WITH_LESS_THAN_2_POINTS, "Route Single Waypoint");
+}
+
+// 13. Tracked queries along slow trajectories against isInsidePolygon at every step
+ApiResult CallIsInsideTracked(const SPointNE* poly, uint16_t count, SPolygonTracker* tracker, SPointNE pt, float rad) {
+    uint8_t res = false;
+    uint8_t state = EResultState::OK;
+    isInsidePolygonTracked(poly, count, tracker, pt, rad, &res, &state);
+    return { res, state };
+}
+
+void test_polygon_tracker() {
+    std::cout << "\n--- Testing isInsidePolygonTracked ---\n";
+
+#if defined(API_FUNCTIONS_INSTRUMENTED)
+    ResetInstrumentation();
+#endif
+
+    int mismatches = 0;
+    int collisions = 0;
+    for (int trial = 0; trial < 20; ++trial) {
+        SPolygonTracker tracker;
+        uint8_t state = EResultState::OK;
+        InitPolygonTracker(g_star_pts, STAR_SIZE, &tracker, &state);
+
+        // 100 Hz samples of a vehicle crossing the star at up to 30 m/s, heading changing slowly
+        SPointNE pt = { RandRange(-150.0f, 150.0f), RandRange(-150.0f, 150.0f) };
+        float heading = RandRange(0.0f, 6.2831853f);
+        for (int step = 0; step < 2000; ++step) {
+            heading += RandRange(-0.05f, 0.05f);
+            pt.north += 0.3f * std::cos(heading);
+            pt.east += 0.3f * std::sin(heading);
+            const float rad = (step % 400 < 200) ? 0.0f : 2.5f;
+
+            ApiResult tracked = CallIsInsideTracked(g_star_pts, STAR_SIZE, &tracker, pt, rad);
+            ApiResult full = CallIsInside(g_star_pts, STAR_SIZE, pt, rad);
+            if (tracked.state != EResultState::OK || tracked.isCollision != full.isCollision) mismatches++;
+            collisions += full.isCollision;
+        }
+    }
+
+    if (mismatches == 0 && collisions > 0) {
+        std::cout << "[PASS] Tracked Trajectories | Collisions: " << collisions << std::endl;
+        g_tests_passed++;
+    }
+    else {
+        std::cout << "[FAIL] Tracked Trajectories | Mismatches: " << mismatches << ", Collisions: " << collisions << std::endl;
+        g_tests_failed++;
+    }
+
+#if defined(API_FUNCTIONS_INSTRUMENTED)
+    // Most samples are far from the boundary relative to the step, so most must reuse the anchor
+    SInstrumentationSnapshot snapshot;
+    SnapshotInstrumentation(&snapshot);
+    const uint64_t* counters = snapshot.rejectCounters;
+    bool reused = counters[ERejectCounterID::TrackerReuses] * 2 > counters[ERejectCounterID::TrackerQueries];
+    std::cout << (reused ? "[PASS] " : "[FAIL] ") << "Tracker Reuses | " << counters[ERejectCounterID::TrackerReuses] << "/"
+        << counters[ERejectCounterID::TrackerQueries] << std::endl;
+    reused ? g_tests_passed++ : g_tests_failed++;
+#endif
+
+    // Input Validation
+    SPolygonTracker tracker;
+    uint8_t state = EResultState::OK;
+    InitPolygonTracker(square_polygon, square_size, &tracker, &state);
+    ASSERT_ERROR_STATE(CallIsInsideTracked(square_polygon, square_size, nullptr, { 5, 5 }, 1.0f), EResultState::BUFFER_IS_NULL_PTR, "Tracked Null Tracker");
+    ASSERT_ERROR_STATE(CallIsInsideTracked(u_shape_pts, u_shape_size, &tracker, { 5, 5 }, 1.0f), EResultState::PREPARED_DATA_INVALID, "Tracked Mismatched Tracker");
+    ASSERT_ERROR_STATE(CallIsInsideTracked(nullptr, 0, &tracker, { 5, 5 }, 1.0f), EResultState::POLYGON_IS_NULL_PTR, "Tracked Null Poly");
+}
+
+ApiResult CallImportGeo(const SPointGeo* ring, uint16_t ringCount, SPointNE* outPolygon, uint16_t outCapacity, uint16_t* outCount, SPolygonBounds* outBounds) {
+    uint8_t state = EResultState::OK;
+    ImportGeoPolygon(0.0, 0.0, 0.0, ring, ringCount, outPolygon, outCapacity, outCount, outBounds, &state);
+    return { (uint8_t)(outCount ? *outCount : 0), state };
+}
+
+void test_import_geo_polygon() {
+    std::cout << "\n--- Testing ImportGeoPolygon ---\n";
+
+    // Origin (0, 0, 0): equator points map to north == 0 exactly, so (0, 0) is exactly collinear.
+    // The ring runs counter-clockwise on the map, repeats a corner and closes on its first vertex.
+    const SPointGeo ring[] = { { 0.0, -0.01, 0.0 }, { 0.0, 0.0, 0.0 }, { 0.0, 0.01, 0.0 }, { 0.01, 0.01, 0.0 },
+        { 0.01, 0.01, 0.0 }, { 0.01, -0.01, 0.0 }, { 0.0, -0.01, 0.0 } };
+    const uint16_t ringSize = 7;
+    const SPointGeo corners[] = { ring[0], ring[2], ring[3], ring[5] };
+
+    SPointNE polygon[ringSize];
+    uint16_t count = 0;
+    SPolygonBounds bounds;
+    ApiResult res = CallImportGeo(ring, ringSize, polygon, ringSize, &count, &bounds);
+
+    // Every kept vertex is one of the corners, converted as GeoToNed does
+    int matched = 0;
+    for (uint16_t i = 0; i < count; ++i) {
+        for (const SPointGeo& corner : corners) {
+            SPointNED ned;
+            GeoToNed(0.0, 0.0, 0.0, corner, &ned);
+            if (std::fabs(polygon[i].north - ned.north) < 1e-3 && std::fabs(polygon[i].east - ned.east) < 1e-3) matched++;
+        }
+    }
+    bool clockwise = true;
+    for (uint16_t i = 0; i < count; ++i) {
+        clockwise = clockwise && orientation(polygon[i], polygon[(i + 1) % count], polygon[(i + 2) % count]) == 2;
+    }
+    bool cleaned = res.state == EResultState::OK && count == 4 && matched == 4 && clockwise;
+    std::cout << (cleaned ? "[PASS] " : "[FAIL] ") << "Import Cleans And Winds | Vertices: " << count << ", Matched: " << matched << std::endl;
+    cleaned ? g_tests_passed++ : g_tests_failed++;
+
+    SPolygonBounds expected;
+    uint8_t state = EResultState::OK;
+    InitPolygonBounds(polygon, count, &expected, &state);
+    bool sameBounds = std::memcmp(&expected, &bounds, sizeof(bounds)) == 0;
+    std::cout << (sameBounds ? "[PASS] " : "[FAIL] ") << "Import Bounds Match InitPolygonBounds" << std::endl;
+    sameBounds ? g_tests_passed++ : g_tests_failed++;
+
+    // A zone ring away from the origin: nothing to drop, same answers as converting by hand
+    const uint16_t zoneSize = 200;
+    SPointGeo zone[zoneSize];
+    SPointNE manual[zoneSize];
+    for (uint16_t i = 0; i < zoneSize; ++i) {
+        const double angle = -2.0 * M_PI * i / zoneSize; // clockwise on the map
+        const double radiusDeg = (i % 2 == 0) ? 0.02 : 0.012;
+        zone[i] = { 0.05 + radiusDeg * std::sin(angle), 0.03 + radiusDeg * std::cos(angle), 100.0 };
+        SPointNED ned;
+        GeoToNed(0.0, 0.0, 0.0, zone[i], &ned);
+        manual[i] = { (float)ned.north, (float)ned.east };
+    }
+    SPointNE imported[zoneSize];
+    res = CallImportGeo(zone, zoneSize, imported, zoneSize, &count, &bounds);
+    int mismatches = (res.state == EResultState::OK && count == zoneSize) ? 0 : 1;
+    for (int i = 0; i < 2000 && mismatches == 0; ++i) {
+        SPointNE pt = { RandRange(4000.0f, 7200.0f), RandRange(1800.0f, 5000.0f) };
+        mismatches += CallIsInside(imported, count, pt, 0.0f).isCollision != CallIsInside(manual, zoneSize, pt, 0.0f).isCollision;
+    }
+    std::cout << (mismatches == 0 ? "[PASS] " : "[FAIL] ") << "Import Matches Manual Conversion | Mismatches: " << mismatches << std::endl;
+    mismatches == 0 ? g_tests_passed++ : g_tests_failed++;
+
+    // Input Validation
+    const SPointGeo line[] = { { 0.0, -0.01, 0.0 }, { 0.0, 0.0, 0.0 }, { 0.0, 0.01, 0.0 } };
+    ASSERT_ERROR_STATE(CallImportGeo(nullptr, 3, polygon, ringSize, &count, &bounds), EResultState::POLYGON_IS_NULL_PTR, "Import Null Ring");
+    ASSERT_ERROR_STATE(CallImportGeo(ring, 2, polygon, ringSize, &count, &bounds), EResultState::POLYGON_WITH_LESS_THAN_3_POINTS, "Import Short Ring");
+    ASSERT_ERROR_STATE(CallImportGeo(line, 3, polygon, ringSize, &count, &bounds), EResultState::POLYGON_WITH_LESS_THAN_3_POINTS, "Import Degenerate Ring");
+    ASSERT_ERROR_STATE(CallImportGeo(ring, ringSize, polygon, ringSize - 1, &count, &bounds), EResultState::OUTPUT_TOO_SMALL, "Import Small Output");
+    ASSERT_ERROR_STATE(CallImportGeo(ring, ringSize, polygon, ringSize, &count, nullptr), EResultState::BUFFER_IS_NULL_PTR, "Import Null Bounds");
+}
+
+// 15. Runner comparing the convex fast paths with the plain queries
+void RunTest_ConvexMatches(const std::string& testName, const SPointNE* poly, uint16_t count, float spread, bool expectConvex) {
+    SPolygonConvexity convexity;
+    uint8_t state = EResultState::OK;
+    InitPolygonConvexity(poly, count, &convexity, &state);
+
+    int mismatches = (state == EResultState::OK && convexity.isConvex == expectConvex) ? 0 : 1;
+    for (uint32_t i = 0; i < 4000; ++i) {
+        SPointNE pt = RandomQueryPoint(poly, count, (i % 2 == 0) ? spread : 3.0f * spread, i);
+        if (i % 5 == 1) {
+            // Just off an edge (either side, up to 1 mm), where the boundary tolerance decides
+            const SPointNE& a = poly[i % count];
+            const SPointNE& b = poly[(i + 1) % count];
+            const float t = RandRange(0.0f, 1.0f);
+            const float length = std::sqrt((b.north - a.north) * (b.north - a.north) + (b.east - a.east) * (b.east - a.east));
+            const float offset = RandRange(-1e-3f, 1e-3f) / length;
+            pt = { a.north + t * (b.north - a.north) - offset * (b.east - a.east), a.east + t * (b.east - a.east) + offset * (b.north - a.north) };
+        }
+        float rad = (i % 3 == 0) ? 0.0f : RandRange(0.0f, 0.3f * spread);
+        float az = RandRange(0.0f, 360.0f);
+        float len = RandRange(0.1f, 2.0f * spread);
+
+        uint8_t res, st;
+        isInsidePolygonConvex(poly, count, &convexity, pt, rad, &res, &st);
+        if (st != EResultState::OK || res != CallIsInside(poly, count, pt, rad).isCollision) mismatches++;
+        doesLineIntersectPolygonConvex(poly, count, &convexity, pt, az, len, &res, &st);
+        if (st != EResultState::OK || res != CallIntersect(poly, count, pt, az, len).isCollision) mismatches++;
+    }
+
+    ReportMismatches(testName, mismatches);
+}
+
+ApiResult CallIsInsideConvex(const SPointNE* poly, uint16_t count, const SPolygonConvexity* convexity, SPointNE pt, float rad) {
+    uint8_t res = false;
+    uint8_t state = EResultState::OK;
+    isInsidePolygonConvex(poly, count, convexity, pt, rad, &res, &state);
+    return { res, state };
+}
+
+bool IsConvex(const SPointNE* poly, uint16_t count) {
+    SPolygonConvexity convexity;
+    uint8_t state = EResultState::OK;
+    InitPolygonConvexity(poly, count, &convexity, &state);
+    return state == EResultState::OK && convexity.isConvex;
+}
+
+void test_convex_polygon() {
+    std::cout << "\n--- Testing isInsidePolygonConvex / doesLineIntersectPolygonConvex ---\n";
+
+    // Regular 64-gon wound both ways, and a rotated corridor 200 m long and 8 m wide
+    const uint16_t roundSize = 64;
+    SPointNE round[roundSize];
+    SPointNE roundReversed[roundSize];
+    for (uint16_t i = 0; i < roundSize; ++i) {
+        const double angle = 2.0 * M_PI * i / roundSize;
+        round[i] = { (float)(50.0 * std::cos(angle)), (float)(50.0 * std::sin(angle)) };
+        roundReversed[roundSize - 1 - i] = round[i];
+    }
+    const float c = std::cos(0.6f), s = std::sin(0.6f);
+    SPointNE corridor[] = { { -100.0f * c + 4.0f * s, -100.0f * s - 4.0f * c }, { 100.0f * c + 4.0f * s, 100.0f * s - 4.0f * c },
+        { 100.0f * c - 4.0f * s, 100.0f * s + 4.0f * c }, { -100.0f * c - 4.0f * s, -100.0f * s + 4.0f * c } };
+
+    RunTest_ConvexMatches("Convex Square", square_polygon, square_size, 15.0f, true);
+    RunTest_ConvexMatches("Convex Triangle", triangle_pts, triangle_size, 15.0f, true);
+    RunTest_ConvexMatches("Convex 64-gon", round, roundSize, 60.0f, true);
+    RunTest_ConvexMatches("Convex 64-gon Reversed", roundReversed, roundSize, 60.0f, true);
+    RunTest_ConvexMatches("Convex Corridor", corridor, 4, 120.0f, true);
+    RunTest_ConvexMatches("Convex Fallback U-Shape", u_shape_pts, u_shape_size, 15.0f, false);
+    RunTest_ConvexMatches("Convex Fallback Star", g_star_pts, STAR_SIZE, 120.0f, false);
+
+    // Detection: a straight vertex is allowed; a double winding, a spike or a repeated vertex is not
+    SPointNE withMidpoint[] = { { 0.0f, 0.0f }, { 0.0f, 5.0f }, { 0.0f, 10.0f }, { 10.0f, 10.0f }, { 10.0f, 0.0f } };
+    SPointNE pentagram[5];
+    for (int i = 0; i < 5; ++i) {
+        const double angle = 2.0 * M_PI * (2 * i) / 5;
+        pentagram[i] = { (float)(10.0 * std::cos(angle)), (float)(10.0 * std::sin(angle)) };
+    }
+    SPointNE spike[] = { { 0.0f, 0.0f }, { 0.0f, 10.0f }, { 0.0f, 5.0f }, { 10.0f, 5.0f } };
+    SPointNE repeated[] = { { 0.0f, 0.0f }, { 0.0f, 10.0f }, { 0.0f, 10.0f }, { 10.0f, 10.0f }, { 10.0f, 0.0f } };
+    bool detected = IsConvex(withMidpoint, 5) && !IsConvex(pentagram, 5) && !IsConvex(spike, 4) && !IsConvex(repeated, 5);
+    std::cout << (detected ? "[PASS] " : "[FAIL] ") << "Convexity Detection" << std::endl;
+    detected ? g_tests_passed++ : g_tests_failed++;
+    RunTest_ConvexMatches("Convex Straight Vertex", withMidpoint, 5, 15.0f, true);
+
+    // Start 0.1 mm outside an edge, pointing away: on the boundary for isInsidePolygon, so a hit
+    SPointNE box[] = { { 0.0f, 0.0f }, { 0.0f, 100.0f }, { 100.0f, 100.0f }, { 100.0f, 0.0f } };
+    SPolygonConvexity boxConvexity;
+    uint8_t boxState = EResultState::OK;
+    InitPolygonConvexity(box, 4, &boxConvexity, &boxState);
+    uint8_t boxHit = false;
+    doesLineIntersectPolygonConvex(box, 4, &boxConvexity, { -1e-4f, 50.0f }, 180.0f, 10.0f, &boxHit, &boxState);
+    const bool boundaryStart = boxHit && CallIntersect(box, 4, { -1e-4f, 50.0f }, 180.0f, 10.0f).isCollision;
+    std::cout << (boundaryStart ? "[PASS] " : "[FAIL] ") << "Convex Segment Starting On Boundary" << std::endl;
+    boundaryStart ? g_tests_passed++ : g_tests_failed++;
+
+    // Input Validation
+    SPolygonConvexity convexity;
+    uint8_t state = EResultState::OK;
+    InitPolygonConvexity(square_polygon, square_size, &convexity, &state);
+    ASSERT_ERROR_STATE(CallIsInsideConvex(square_polygon, square_size, nullptr, { 5, 5 }, 1.0f), EResultState::BUFFER_IS_NULL_PTR, "Convex Null Descriptor");
+    ASSERT_ERROR_STATE(CallIsInsideConvex(u_shape_pts, u_shape_size, &convexity, { 5, 5 }, 1.0f), EResultState::PREPARED_DATA_INVALID, "Convex Mismatched Descriptor");
+    ASSERT_ERROR_STATE(CallIsInsideConvex(nullptr, 0, &convexity, { 5, 5 }, 1.0f), EResultState::POLYGON_IS_NULL_PTR, "Convex Null Poly");
+}
+
+// 16. Multi-ring zones against single-ring queries and an analytic square-with-hole reference
+ApiResult CallIsInsideMulti(const SPointNE* points, const uint32_t* offsets, uint32_t ringCount, SPointNE pt, float rad) {
+    uint8_t res = false;
+    uint8_t state = EResultState::OK;
+    isInsideMultiPolygon(points, offsets, ringCount, pt, rad, &res, &state);
+    return { res, state };
+}
+
+ApiResult CallIntersectMulti(const SPointNE* points, const uint32_t* offsets, uint32_t ringCount, SPointNE pt, float az, float len) {
+    uint8_t res = false;
+    uint8_t state = EResultState::OK;
+    doesLineIntersectMultiPolygon(points, offsets, ringCount, pt, az, len, &res, &state);
+    return { res, state };
+}
+
+// Distance from pt to the boundary of the axis-aligned square [lo, hi] x [lo, hi]
+double DistToSquareBoundary(const SPointNE& pt, double lo, double hi) {
+    const bool inside = pt.north > lo && pt.north < hi && pt.east > lo && pt.east < hi;
+    if (inside) return MIN(MIN(pt.north - lo, hi - pt.north), MIN(pt.east - lo, hi - pt.east));
+    const double dn = MAX(MAX(lo - pt.north, 0.0), pt.north - hi);
+    const double de = MAX(MAX(lo - pt.east, 0.0), pt.east - hi);
+    return std::sqrt(dn * dn + de * de);
+}
+
+bool IsInsideSquare(const SPointNE& pt, double lo, double hi) {
+    return pt.north > lo && pt.north < hi && pt.east > lo && pt.east < hi;
+}
+
+const uint32_t BIG_RING_SIZE = 70000;
+SPointNE g_big_ring_pts[BIG_RING_SIZE + 32];
+
+void test_multi_ring_polygon() {
+    std::cout << "\n--- Testing isInsideMultiPolygon / doesLineIntersectMultiPolygon ---\n";
+
+    // 1. A single ring answers exactly as the plain queries
+    int mismatches = 0;
+    const uint32_t uOffsets[] = { 0, u_shape_size };
+    const uint32_t starOffsets[] = { 0, STAR_SIZE };
+    for (uint32_t i = 0; i < 4000; ++i) {
+        const bool onStar = (i % 2 == 1);
+        const SPointNE* poly = onStar ? g_star_pts : u_shape_pts;
+        const uint16_t count = onStar ? STAR_SIZE : u_shape_size;
+        const float spread = onStar ? 400.0f : 15.0f;
+        const SPointNE pt = RandomQueryPoint(poly, count, spread, i);
+        float rad = (i % 3 == 0) ? 0.0f : RandRange(0.0f, 0.2f * spread);
+        float az = RandRange(0.0f, 360.0f);
+        float len = RandRange(0.1f, spread);
+
+        const uint32_t* offsets = onStar ? starOffsets : uOffsets;
+        if (CallIsInsideMulti(poly, offsets, 1, pt, rad).isCollision != CallIsInside(poly, count, pt, rad).isCollision) mismatches++;
+        if (CallIntersectMulti(poly, offsets, 1, pt, az, len).isCollision != CallIntersect(poly, count, pt, az, len).isCollision) mismatches++;
+    }
+    ReportMismatches("Multi-Ring Single Ring", mismatches);
+
+    // 2. Square 0..30 with a hole 10..20, the hole wound both ways
+    SPointNE donut[] = { { 0.0f, 0.0f }, { 0.0f, 30.0f }, { 30.0f, 30.0f }, { 30.0f, 0.0f },
+        { 10.0f, 10.0f }, { 10.0f, 20.0f }, { 20.0f, 20.0f }, { 20.0f, 10.0f } };
+    SPointNE donutReversed[] = { { 0.0f, 0.0f }, { 0.0f, 30.0f }, { 30.0f, 30.0f }, { 30.0f, 0.0f },
+        { 20.0f, 10.0f }, { 20.0f, 20.0f }, { 10.0f, 20.0f }, { 10.0f, 10.0f } };
+    const uint32_t donutOffsets[] = { 0, 4, 8 };
+
+    mismatches = 0;
+    for (int i = 0; i < 4000; ++i) {
+        const SPointNE* points = (i % 2 == 0) ? donut : donutReversed;
+        SPointNE pt = { RandRange(-10.0f, 40.0f), RandRange(-10.0f, 40.0f) };
+        float rad = (i % 3 == 0) ? 0.0f : RandRange(0.0f, 6.0f);
+        float az = RandRange(0.0f, 360.0f);
+        float len = RandRange(0.1f, 30.0f);
+
+        const bool inZone = IsInsideSquare(pt, 0.0, 30.0) != IsInsideSquare(pt, 10.0, 20.0);
+        const double clearance = MIN(DistToSquareBoundary(pt, 0.0, 30.0), DistToSquareBoundary(pt, 10.0, 20.0));
+        const bool expectInside = inZone || clearance < rad;
+
+        // From inside the hole a segment hits when its end leaves the (convex) hole; from outside
+        // the zone, when it reaches the outer ring
+        const double theta = az * (M_PI / 180.0);
+        const SPointNE end = { (float)(pt.north + len * std::cos(theta)), (float)(pt.east + len * std::sin(theta)) };
+        bool expectHit = inZone;
+        if (IsInsideSquare(pt, 10.0, 20.0)) expectHit = !IsInsideSquare(end, 10.0, 20.0);
+        else if (!IsInsideSquare(pt, 0.0, 30.0)) expectHit = CallIntersect(donut, 4, pt, az, len).isCollision;
+
+        if (CallIsInsideMulti(points, donutOffsets, 2, pt, rad).isCollision != expectInside) mismatches++;
+        if (CallIntersectMulti(points, donutOffsets, 2, pt, az, len).isCollision != expectHit) mismatches++;
+    }
+    ReportMismatches("Multi-Ring Square With Hole", mismatches);
+
+    bool known = !CallIsInsideMulti(donut, donutOffsets, 2, { 15.0f, 15.0f }, 4.0f).isCollision &&
+        CallIsInsideMulti(donut, donutOffsets, 2, { 15.0f, 15.0f }, 6.0f).isCollision &&
+        CallIsInsideMulti(donut, donutOffsets, 2, { 5.0f, 15.0f }, 0.0f).isCollision &&
+        CallIsInsideMulti(donut, donutOffsets, 2, { 10.0f, 15.0f }, 0.0f).isCollision &&
+        !CallIntersectMulti(donut, donutOffsets, 2, { 15.0f, 15.0f }, 0.0f, 4.0f).isCollision &&
+        CallIntersectMulti(donut, donutOffsets, 2, { 15.0f, 15.0f }, 0.0f, 6.0f).isCollision;
+    std::cout << (known ? "[PASS] " : "[FAIL] ") << "Multi-Ring Known Hole Cases" << std::endl;
+    known ? g_tests_passed++ : g_tests_failed++;
+
+    // 3. A ring above the uint16_t vertex limit: circle of radius 1000 around a 32-gon hole of radius 100
+    for (uint32_t i = 0; i < BIG_RING_SIZE; ++i) {
+        const double angle = 2.0 * M_PI * i / BIG_RING_SIZE;
+        g_big_ring_pts[i] = { (float)(1000.0 * std::cos(angle)), (float)(1000.0 * std::sin(angle)) };
+    }
+    for (uint32_t i = 0; i < 32; ++i) {
+        const double angle = 2.0 * M_PI * i / 32;
+        g_big_ring_pts[BIG_RING_SIZE + i] = { (float)(100.0 * std::cos(angle)), (float)(100.0 * std::sin(angle)) };
+    }
+    const uint32_t bigOffsets[] = { 0, BIG_RING_SIZE, BIG_RING_SIZE + 32 };
+    bool big = CallIsInsideMulti(g_big_ring_pts, bigOffsets, 2, { 500.0f, 0.0f }, 0.0f).isCollision &&
+        CallIsInsideMulti(g_big_ring_pts, bigOffsets, 2, { 0.0f, -990.0f }, 20.0f).isCollision &&
+        !CallIsInsideMulti(g_big_ring_pts, bigOffsets, 2, { 0.0f, 1500.0f }, 400.0f).isCollision &&
+        !CallIsInsideMulti(g_big_ring_pts, bigOffsets, 2, { 0.0f, 0.0f }, 50.0f).isCollision &&
+        CallIsInsideMulti(g_big_ring_pts, bigOffsets, 2, { 0.0f, 0.0f }, 150.0f).isCollision &&
+        CallIntersectMulti(g_big_ring_pts, bigOffsets, 2, { 0.0f, 1500.0f }, 270.0f, 600.0f).isCollision &&
+        !CallIntersectMulti(g_big_ring_pts, bigOffsets, 2, { 0.0f, 1500.0f }, 90.0f, 600.0f).isCollision;
+    std::cout << (big ? "[PASS] " : "[FAIL] ") << "Multi-Ring Above 65535 Vertices" << std::endl;
+    big ? g_tests_passed++ : g_tests_failed++;
+
+    // Input Validation
+    const uint32_t shortRing[] = { 0, 4, 6 };
+    const uint32_t backwards[] = { 0, 4, 2 };
+    ASSERT_ERROR_STATE(CallIsInsideMulti(nullptr, donutOffsets, 2, { 5, 5 }, 1.0f), EResultState::POLYGON_IS_NULL_PTR, "Multi-Ring Null Points");
+    ASSERT_ERROR_STATE(CallIsInsideMulti(donut, nullptr, 2, { 5, 5 }, 1.0f), EResultState::BUFFER_IS_NULL_PTR, "Multi-Ring Null Offsets");
+    ASSERT_ERROR_STATE(CallIsInsideMulti(donut, donutOffsets, 0, { 5, 5 }, 1.0f), EResultState::POLYGON_WITH_LESS_THAN_3_POINTS, "Multi-Ring No Ring");
+    ASSERT_ERROR_STATE(CallIsInsideMulti(donut, shortRing, 2, { 5, 5 }, 1.0f), EResultState::POLYGON_WITH_LESS_THAN_3_POINTS, "Multi-Ring Short Ring");
+    ASSERT_ERROR_STATE(CallIntersectMulti(donut, backwards, 2, { 5, 5 }, 0.0f, 1.0f), EResultState::POLYGON_WITH_LESS_THAN_3_POINTS, "Multi-Ring Backward Offsets");
+    ASSERT_ERROR_STATE(CallIntersectMulti(donut, donutOffsets, 2, { 5, 5 }, 0.0f, 0.0f), EResultState::MAX_LENGTH_LESS_OR_EQUAL_TO_ZERO, "Multi-Ring Zero Length");
+}
+
+// 17. Robust path: orientation with a known exact sign, at every scale
+// orientation of p against the line through q and r on the diagonal north == east (r beyond q):
+// the sign of p.north - p.east, whatever the magnitudes of q and r
+int DiagonalOrientation(const SPointNE& p) {
+    if (p.north == p.east) return 0;
+    return (p.north > p.east) ? 1 : 2;
+}
+
+void test_robust_orientation() {
+    std::cout << "\n--- Testing the robust orientation predicate ---\n";
+
+    int robustMismatches = 0;
+    int doubleMismatches = 0;
+    for (int i = 0; i < 5000; ++i) {
+        // A tiny or 1-ulp offset p next to a diagonal line through far points, so that the
+        // differences round away the offset and only the exact path sees it
+        const float scale = std::pow(10.0f, (float)(i % 13 - 6));
+        const float c = RandRange(1.0f, 2.0f) * scale;
+        SPointNE p = { c, c };
+        if (i % 3 == 0) p.north = std::nextafter(c, 2.0f * c);
+        else if (i % 3 == 1) p = { RandRange(-1e-20f, 1e-20f), RandRange(-1e-20f, 1e-20f) };
+        const float b = RandRange(1e3f, 1e6f);
+        const SPointNE q = { b, b };
+        const SPointNE r = { 2.0f * b, 2.0f * b };
+
+        const int expected = DiagonalOrientation(p);
+        const int reversed = (expected == 0) ? 0 : 3 - expected;
+        if (orientation<SRobustPrecision>(p, q, r) != expected || orientation<SRobustPrecision>(q, r, p) != expected ||
+            orientation<SRobustPrecision>(r, p, q) != expected || orientation<SRobustPrecision>(p, r, q) != reversed) {
+            robustMismatches++;
+        }
+        if (orientation<SDoublePrecision>(p, q, r) != expected) doubleMismatches++;
+    }
+    std::cout << (robustMismatches == 0 ? "[PASS] " : "[FAIL] ") << "Robust Orientation Exact Sign | Mismatches: " << robustMismatches << std::endl;
+    (robustMismatches == 0) ? g_tests_passed++ : g_tests_failed++;
+
+    // The same cases defeat the tolerance path (offsets below EPSILON * 100 read as collinear)
+    std::cout << (doubleMismatches > 0 ? "[PASS] " : "[FAIL] ") << "Tolerance Orientation Misses Near-Collinear | Mismatches: " << doubleMismatches << std::endl;
+    (doubleMismatches > 0) ? g_tests_passed++ : g_tests_failed++;
+
+    // Well-conditioned segments: the robust and tolerance paths agree
+    int intersectMismatches = 0;
+    for (int i = 0; i < 5000; ++i) {
+        SPointNE p1 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+        SPointNE q1 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+        SPointNE p2 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+        SPointNE q2 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+        if (doSegmentsIntersect<SRobustPrecision>(p1, q1, p2, q2) != doSegmentsIntersect<SDoublePrecision>(p1, q1, p2, q2)) {
+            intersectMismatches++;
+        }
+    }
+    std::cout << (intersectMismatches == 0 ? "[PASS] " : "[FAIL] ") << "doSegmentsIntersect Robust == Double | Mismatches: " << intersectMismatches << std::endl;
+    (intersectMismatches == 0) ? g_tests_passed++ : g_tests_failed++;
+
+    // Sub-millimetre segments: parallel 10 um apart do not touch, crossing ones and collinear overlapping ones do
+    const SPointNE a = { 0.0f, 0.0f }, b = { 1e-4f, 1e-4f };
+    const bool small = !doSegmentsIntersect<SRobustPrecision>(a, b, { 0.0f, 1e-5f }, { 1e-4f, 1.1e-4f }) &&
+        doSegmentsIntersect<SRobustPrecision>(a, b, { 0.0f, 1e-4f }, { 1e-4f, 0.0f }) &&
+        doSegmentsIntersect<SRobustPrecision>(a, b, { 5e-5f, 5e-5f }, { 2e-4f, 2e-4f }) &&
+        !doSegmentsIntersect<SRobustPrecision>(a, b, { 2e-4f, 2e-4f }, { 3e-4f, 3e-4f });
+    std::cout << (small ? "[PASS] " : "[FAIL] ") << "doSegmentsIntersect Robust Small Scale" << std::endl;
+    small ? g_tests_passed++ : g_tests_failed++;
+
+#if defined(API_FUNCTIONS_INSTRUMENTED)
+    // The filter alone decides well-conditioned triangles
+    SInstrumentationSnapshot before;
+    SnapshotInstrumentation(&before);
+    int collinear = 0;
+    for (int i = 0; i < 1000; ++i) {
+        SPointNE p1 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+        SPointNE q1 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+        SPointNE p2 = { RandRange(-100.0f, 100.0f), RandRange(-100.0f, 100.0f) };
+        collinear += (orientation<SRobustPrecision>(p1, q1, p2) == 0);
+    }
+    SInstrumentationSnapshot after;
+    SnapshotInstrumentation(&after);
+    const uint64_t* counters = after.predicateCounters;
+    const uint64_t queries = counters[EPredicateCounterID::OrientQueries] - before.predicateCounters[EPredicateCounterID::OrientQueries];
+    const uint64_t fallbacks = counters[EPredicateCounterID::OrientExactFallbacks] - before.predicateCounters[EPredicateCounterID::OrientExactFallbacks];
+    bool filtered = queries == 1000 && fallbacks == 0 && collinear == 0;
+    std::cout << (filtered ? "[PASS] " : "[FAIL] ") << "Robust Filter Decides | Exact: " << fallbacks << "/" << queries << std::endl;
+    filtered ? g_tests_passed++ : g_tests_failed++;
+#endif
+}
+
+void test_instrumentation() {
+    std::cout << "\n--- Testing instrumentation counters and timers ---\n";
+
+#if defined(API_FUNCTIONS_INSTRUMENTED)
+    ResetInstrumentation();
+
+    // A point far outside the square: every call walks all 4 edges in both loops
+    const int calls = 100;
+    for (int i = 0; i < calls; ++i) {
+        CallIsInside(square_polygon, square_size, { 100, 100 }, 1.0f);
+    }
+    SInstrumentationSnapshot snapshot;
+    SnapshotInstrumentation(&snapshot);
+    const uint64_t* hits = snapshot.covPoints[ECovFuncID::IsInside];
+    bool counted = hits[0] == calls && hits[3] == 4 * calls && hits[7] == 4 * calls && hits[10] == calls && hits[6] == 0 &&
+        snapshot.timerCalls[EApiTimerID::TimerIsInsidePolygon] == 0;
+    std::cout << (counted ? "[PASS] " : "[FAIL] ") << "Site Counters | Entries: " << hits[0] << ", Ray Edges: " << hits[3]
+        << ", Distance Edges: " << hits[7] << ", Timed Calls: " << snapshot.timerCalls[EApiTimerID::TimerIsInsidePolygon] << std::endl;
+    counted ? g_tests_passed++ : g_tests_failed++;
+
+    // Timers count only while enabled; doesLineIntersectPolygon's inner isInsidePolygon is timed too
+    EnableApiTimers(true);
+    for (int i = 0; i < calls; ++i) {
+        CallIntersect(square_polygon, square_size, { 100, 100 }, 0.0f, 5.0f);
+    }
+    EnableApiTimers(false);
+    CallIntersect(square_polygon, square_size, { 100, 100 }, 0.0f, 5.0f);
+    SnapshotInstrumentation(&snapshot);
+    bool timed = snapshot.timerCalls[EApiTimerID::TimerDoesLineIntersectPolygon] == calls &&
+        snapshot.timerCalls[EApiTimerID::TimerIsInsidePolygon] == calls &&
+        snapshot.timerCycles[EApiTimerID::TimerDoesLineIntersectPolygon] >= snapshot.timerCycles[EApiTimerID::TimerIsInsidePolygon] &&
+        snapshot.timerCycles[EApiTimerID::TimerIsInsidePolygon] > 0;
+    std::cout << (timed ? "[PASS] " : "[FAIL] ") << "API Timers | Calls: " << snapshot.timerCalls[EApiTimerID::TimerDoesLineIntersectPolygon]
+        << ", Cycles: " << snapshot.timerCycles[EApiTimerID::TimerDoesLineIntersectPolygon] << std::endl;
+    timed ? g_tests_passed++ : g_tests_failed++;
+
+    ResetInstrumentation();
+    SnapshotInstrumentation(&snapshot);
+    bool cleared = snapshot.covPoints[ECovFuncID::IsInside][0] == 0 && snapshot.timerCalls[EApiTimerID::TimerIsInsidePolygon] == 0 &&
+        snapshot.predicateCounters[EPredicateCounterID::OrientQueries] == 0;
+    std::cout << (cleared ? "[PASS] " : "[FAIL] ") << "Instrumentation Reset" << std::endl;
+    cleared ? g_tests_passed++ : g_tests_failed++;
+#else
+    std::cout << "Skipped (instrumentation not built)\n";
+#endif
+}
+
 void verify_full_coverage(int total_expected, ECovFuncID funcID, std::string func_name) {
-#if defined(_DEBUG) || !defined(NDEBUG)
+#if defined(API_FUNCTIONS_INSTRUMENTED)
     std::cout << "\n--- Coverage Verification ---\n";
 
-    bool* coverage_map = GetCoverageArray(funcID);
+    SInstrumentationSnapshot snapshot;
+    SnapshotInstrumentation(&snapshot);
+    const uint64_t* coverage_map = snapshot.covPoints[(int)funcID];
 
     int missed_count = 0;
     for (int i = 0; i < total_expected; i++) {
-        if (!coverage_map[i]) {
+        if (coverage_map[i] == 0) {
             std::cout << "[FAIL] Code Logic at COV_POINT(" << i << ") was NEVER executed!" << std::endl;
             missed_count++;
         }
@@ -279,7 +1473,7 @@ int main() {
 #if defined(_DEBUG) || !defined(NDEBUG)
 
 #ifdef _WIN32
-    ResetCoverage();
+    ResetInstrumentation();
 #endif
 
 
@@ -291,6 +1485,54 @@ int main() {
     test_intersection();
     verify_full_coverage(7, ECovFuncID::Intersect, "doesLineIntersectPolygon");
 
+    // 3. Test isInsidePolygonPrepared
+    test_prepared_polygon();
+
+    // 4. Test isInsidePolygonBatch (reuses the star built above)
+    test_batch_polygon();
+
+    // 5. Test QueryZonesCircle / QueryZonesSegment
+    test_zone_index();
+
+    // 6. Test getFirstRayHit
+    test_first_ray_hit();
+
+    // 7. Test the float / double precision policies
+    test_precision_paths();
+
+    // 8. Test getPolygonClearance
+    test_polygon_clearance();
+
+    // 9. Test the bounds-aware queries
+    test_polygon_bounds();
+
+    // 10. Test the scratch arena
+    test_scratch_arena();
+
+    // 11. Test the parallel containment batch
+    test_parallel_batch_polygon();
+
+    // 12. Test the route check
+    test_route_polygon();
+
+    // 13. Test the tracked queries
+    test_polygon_tracker();
+
+    // 14. Test the geodetic polygon import
+    test_import_geo_polygon();
+
+    // 15. Test the convex fast paths
+    test_convex_polygon();
+
+    // 16. Test the multi-ring zones
+    test_multi_ring_polygon();
+
+    // 17. Test the robust orientation predicate
+    test_robust_orientation();
+
+    // 18. Test the instrumentation counters (resets them, so it runs last)
+    test_instrumentation();
+
     std::cout << "\n---------------------------------\n";
     std::cout << "SUMMARY: Passed: " << g_tests_passed << ", Failed: " << g_tests_failed << std::endl;
     std::cout << "Log saved to: test_results_geo.log" << std::endl;